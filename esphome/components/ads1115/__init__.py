@@ -6,6 +6,11 @@ from esphome.const import CONF_ID
 DEPENDENCIES = ["i2c"]
 MULTI_CONF = True
 
+
+def AUTO_LOAD() -> list[str]:
+    return i2c.async_transactions_auto_load()
+
+
 ads1115_ns = cg.esphome_ns.namespace("ads1115")
 ADS1115Component = ads1115_ns.class_("ADS1115Component", cg.Component, i2c.I2CDevice)
 
@@ -28,5 +33,6 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     await i2c.register_i2c_device(var, config)
+    i2c.request_async_transactions()
 
     cg.add(var.set_continuous_mode(config[CONF_CONTINUOUS_MODE]))
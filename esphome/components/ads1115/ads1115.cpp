@@ -1,5 +1,6 @@
 #include "ads1115.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -71,8 +72,8 @@ void ADS1115Component::dump_config() {
     ESP_LOGE(TAG, ESP_LOG_MSG_COMM_FAIL);
   }
 }
-float ADS1115Component::request_measurement(ADS1115Multiplexer multiplexer, ADS1115Gain gain,
-                                            ADS1115Resolution resolution, ADS1115Samplerate samplerate) {
+uint16_t ADS1115Component::build_config_(ADS1115Multiplexer multiplexer, ADS1115Gain gain,
+                                         ADS1115Samplerate samplerate) const {
   uint16_t config = this->prev_config_;
   // Multiplexer
   //        0bxBBBxxxxxxxxxxxx
@@ -93,85 +94,48 @@ float ADS1115Component::request_measurement(ADS1115Multiplexer multiplexer, ADS1
     // Start conversion
     config |= 0b1000000000000000;
   }
+  return config;
+}
 
-  if (!this->continuous_mode_ || this->prev_config_ != config) {
-    if (!this->write_byte_16(ADS1115_REGISTER_CONFIG, config)) {
-      this->status_set_warning();
-      return NAN;
-    }
-    this->prev_config_ = config;
-
-    // Delay calculated as: ceil((1000/SPS)+.5)
-    if (resolution == ADS1015_12_BITS) {
-      switch (samplerate) {
-        case ADS1115_8SPS:
-          delay(9);
-          break;
-        case ADS1115_16SPS:
-          delay(5);
-          break;
-        case ADS1115_32SPS:
-          delay(3);
-          break;
-        case ADS1115_64SPS:
-        case ADS1115_128SPS:
-          delay(2);
-          break;
-        default:
-          delay(1);
-          break;
-      }
-    } else {
-      switch (samplerate) {
-        case ADS1115_8SPS:
-          delay(126);  // NOLINT
-          break;
-        case ADS1115_16SPS:
-          delay(63);  // NOLINT
-          break;
-        case ADS1115_32SPS:
-          delay(32);
-          break;
-        case ADS1115_64SPS:
-          delay(17);
-          break;
-        case ADS1115_128SPS:
-          delay(9);
-          break;
-        case ADS1115_250SPS:
-          delay(5);
-          break;
-        case ADS1115_475SPS:
-          delay(3);
-          break;
-        case ADS1115_860SPS:
-          delay(2);
-          break;
-      }
-    }
-
-    // in continuous mode, conversion will always be running, rely on the delay
-    // to ensure conversion is taking place with the correct settings
-    // can we use the rdy pin to trigger when a conversion is done?
-    if (!this->continuous_mode_) {
-      uint32_t start = millis();
-      while (this->read_byte_16(ADS1115_REGISTER_CONFIG, &config) && (config >> 15) == 0) {
-        if (millis() - start > 100) {
-          ESP_LOGW(TAG, "Reading ADS1115 timed out");
-          this->status_set_warning();
-          return NAN;
-        }
-        yield();
-      }
+uint32_t ADS1115Component::conversion_time_(ADS1115Resolution resolution, ADS1115Samplerate samplerate) {
+  // Delay calculated as: ceil((1000/SPS)+.5)
+  if (resolution == ADS1015_12_BITS) {
+    switch (samplerate) {
+      case ADS1115_8SPS:
+        return 9;
+      case ADS1115_16SPS:
+        return 5;
+      case ADS1115_32SPS:
+        return 3;
+      case ADS1115_64SPS:
+      case ADS1115_128SPS:
+        return 2;
+      default:
+        return 1;
     }
   }
-
-  uint16_t raw_conversion;
-  if (!this->read_byte_16(ADS1115_REGISTER_CONVERSION, &raw_conversion)) {
-    this->status_set_warning();
-    return NAN;
+  switch (samplerate) {
+    case ADS1115_8SPS:
+      return 126;  // NOLINT
+    case ADS1115_16SPS:
+      return 63;  // NOLINT
+    case ADS1115_32SPS:
+      return 32;
+    case ADS1115_64SPS:
+      return 17;
+    case ADS1115_128SPS:
+      return 9;
+    case ADS1115_250SPS:
+      return 5;
+    case ADS1115_475SPS:
+      return 3;
+    case ADS1115_860SPS:
+    default:
+      return 2;
   }
+}
 
+float ADS1115Component::convert_(uint16_t raw_conversion, ADS1115Gain gain, ADS1115Resolution resolution) {
   if (resolution == ADS1015_12_BITS) {
     bool negative = (raw_conversion >> 15) == 1;
 
@@ -214,9 +178,125 @@ float ADS1115Component::request_measurement(ADS1115Multiplexer multiplexer, ADS1
     default:
       millivolts = NAN;
   }
+  return millivolts / 1e3f;
+}
+
+float ADS1115Component::request_measurement(ADS1115Multiplexer multiplexer, ADS1115Gain gain,
+                                            ADS1115Resolution resolution, ADS1115Samplerate samplerate) {
+  uint16_t config = this->build_config_(multiplexer, gain, samplerate);
+
+  if (!this->continuous_mode_ || this->prev_config_ != config) {
+    if (!this->write_byte_16(ADS1115_REGISTER_CONFIG, config)) {
+      this->status_set_warning();
+      return NAN;
+    }
+    this->prev_config_ = config;
+
+    delay(conversion_time_(resolution, samplerate));
+
+    // in continuous mode, conversion will always be running, rely on the delay
+    // to ensure conversion is taking place with the correct settings
+    // can we use the rdy pin to trigger when a conversion is done?
+    if (!this->continuous_mode_) {
+      uint32_t start = millis();
+      while (this->read_byte_16(ADS1115_REGISTER_CONFIG, &config) && (config >> 15) == 0) {
+        if (millis() - start > 100) {
+          ESP_LOGW(TAG, "Reading ADS1115 timed out");
+          this->status_set_warning();
+          return NAN;
+        }
+        yield();
+      }
+    }
+  }
+
+  uint16_t raw_conversion;
+  if (!this->read_byte_16(ADS1115_REGISTER_CONVERSION, &raw_conversion)) {
+    this->status_set_warning();
+    return NAN;
+  }
 
   this->status_clear_warning();
-  return millivolts / 1e3f;
+  return convert_(raw_conversion, gain, resolution);
+}
+
+void ADS1115Component::request_measurement_async(ADS1115Multiplexer multiplexer, ADS1115Gain gain,
+                                                 ADS1115Resolution resolution, ADS1115Samplerate samplerate,
+                                                 std::function<void(float)> &&callback) {
+  this->measurements_.push_back({multiplexer, gain, resolution, samplerate, 0, std::move(callback)});
+  if (this->measurements_.size() == 1)
+    this->start_measurement_();
+}
+
+void ADS1115Component::start_measurement_() {
+  auto &measurement = this->measurements_.front();
+  measurement.config = this->build_config_(measurement.multiplexer, measurement.gain, measurement.samplerate);
+  if (this->continuous_mode_ && this->prev_config_ == measurement.config) {
+    this->read_measurement_();
+    return;
+  }
+
+  const uint8_t config[2] = {static_cast<uint8_t>(measurement.config >> 8), static_cast<uint8_t>(measurement.config)};
+  this->transaction_.clear();
+  this->transaction_.write_register(ADS1115_REGISTER_CONFIG, config, 2);
+  auto err = this->submit(&this->transaction_, [this](i2c::ErrorCode err) {
+    if (err != i2c::ERROR_OK) {
+      this->finish_measurement_(NAN);
+      return;
+    }
+    auto &measurement = this->measurements_.front();
+    this->prev_config_ = measurement.config;
+    this->conversion_start_ = millis();
+    this->set_timeout("conversion", conversion_time_(measurement.resolution, measurement.samplerate),
+                      [this]() { this->read_measurement_(); });
+  });
+  if (err != i2c::ERROR_OK)
+    this->finish_measurement_(NAN);
+}
+
+void ADS1115Component::read_measurement_() {
+  // In single-shot mode the config register tells whether the conversion has finished; read it together with the
+  // result so a finished conversion costs a single transaction
+  this->transaction_.clear();
+  if (!this->continuous_mode_)
+    this->transaction_.read_register(ADS1115_REGISTER_CONFIG, this->read_buffer_, 2);
+  this->transaction_.read_register(ADS1115_REGISTER_CONVERSION, this->read_buffer_ + 2, 2);
+  auto err = this->submit(&this->transaction_, [this](i2c::ErrorCode err) {
+    if (err != i2c::ERROR_OK) {
+      this->finish_measurement_(NAN);
+      return;
+    }
+    auto &measurement = this->measurements_.front();
+    if (this->prev_config_ != measurement.config) {
+      // A synchronous measurement has reconfigured the chip in the meantime
+      this->start_measurement_();
+      return;
+    }
+    if (!this->continuous_mode_ && (this->read_buffer_[0] >> 7) == 0) {
+      if (millis() - this->conversion_start_ > 100) {
+        ESP_LOGW(TAG, "Reading ADS1115 timed out");
+        this->finish_measurement_(NAN);
+        return;
+      }
+      this->set_timeout("conversion", 1, [this]() { this->read_measurement_(); });
+      return;
+    }
+    const uint16_t raw_conversion = encode_uint16(this->read_buffer_[2], this->read_buffer_[3]);
+    this->status_clear_warning();
+    this->finish_measurement_(convert_(raw_conversion, measurement.gain, measurement.resolution));
+  });
+  if (err != i2c::ERROR_OK)
+    this->finish_measurement_(NAN);
+}
+
+void ADS1115Component::finish_measurement_(float value) {
+  if (std::isnan(value))
+    this->status_set_warning();
+  auto callback = std::move(this->measurements_.front().callback);
+  this->measurements_.pop_front();
+  callback(value);
+  if (!this->measurements_.empty())
+    this->start_measurement_();
 }
 
 }  // namespace ads1115
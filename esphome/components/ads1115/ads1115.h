@@ -3,6 +3,8 @@
 #include "esphome/components/i2c/i2c.h"
 #include "esphome/core/component.h"
 
+#include <deque>
+#include <functional>
 #include <vector>
 
 namespace esphome {
@@ -54,10 +56,35 @@ class ADS1115Component : public Component, public i2c::I2CDevice {
   /// Helper method to request a measurement from a sensor.
   float request_measurement(ADS1115Multiplexer multiplexer, ADS1115Gain gain, ADS1115Resolution resolution,
                             ADS1115Samplerate samplerate);
+  /// Queue a measurement that runs without blocking; callback receives the voltage, or NAN on failure.
+  void request_measurement_async(ADS1115Multiplexer multiplexer, ADS1115Gain gain, ADS1115Resolution resolution,
+                                 ADS1115Samplerate samplerate, std::function<void(float)> &&callback);
 
  protected:
+  struct Measurement {
+    ADS1115Multiplexer multiplexer;
+    ADS1115Gain gain;
+    ADS1115Resolution resolution;
+    ADS1115Samplerate samplerate;
+    uint16_t config;
+    std::function<void(float)> callback;
+  };
+
+  uint16_t build_config_(ADS1115Multiplexer multiplexer, ADS1115Gain gain, ADS1115Samplerate samplerate) const;
+  /// Time in ms a conversion takes at the given settings
+  static uint32_t conversion_time_(ADS1115Resolution resolution, ADS1115Samplerate samplerate);
+  static float convert_(uint16_t raw_conversion, ADS1115Gain gain, ADS1115Resolution resolution);
+  void start_measurement_();
+  void read_measurement_();
+  void finish_measurement_(float value);
+
   uint16_t prev_config_{0};
   bool continuous_mode_;
+  /// Queued asynchronous measurements; the chip converts one at a time, so only the front one is in progress
+  std::deque<Measurement> measurements_;
+  i2c::I2CTransaction transaction_;
+  uint8_t read_buffer_[4];
+  uint32_t conversion_start_{0};
 };
 
 }  // namespace ads1115
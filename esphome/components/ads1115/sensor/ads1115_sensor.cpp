@@ -12,11 +12,17 @@ float ADS1115Sensor::sample() {
 }
 
 void ADS1115Sensor::update() {
-  float v = this->sample();
-  if (!std::isnan(v)) {
-    ESP_LOGD(TAG, "'%s': Got Voltage=%fV", this->get_name().c_str(), v);
-    this->publish_state(v);
-  }
+  if (this->measurement_pending_)
+    return;
+  this->measurement_pending_ = true;
+  this->parent_->request_measurement_async(this->multiplexer_, this->gain_, this->resolution_, this->samplerate_,
+                                           [this](float v) {
+                                             this->measurement_pending_ = false;
+                                             if (!std::isnan(v)) {
+                                               ESP_LOGD(TAG, "'%s': Got Voltage=%fV", this->get_name().c_str(), v);
+                                               this->publish_state(v);
+                                             }
+                                           });
 }
 
 void ADS1115Sensor::dump_config() {
@@ -31,6 +31,7 @@ class ADS1115Sensor : public sensor::Sensor,
   ADS1115Gain gain_;
   ADS1115Resolution resolution_;
   ADS1115Samplerate samplerate_;
+  bool measurement_pending_{false};
 };
 
 }  // namespace ads1115
@@ -84,11 +84,13 @@ SERVICE_ARG_NATIVE_TYPES: dict[str, MockObj] = {
     .operator("ref"),
 }
 CONF_ENCRYPTION = "encryption"
+CONF_ADAPTIVE_BATCHING = "adaptive_batching"
 CONF_BATCH_DELAY = "batch_delay"
 CONF_CUSTOM_SERVICES = "custom_services"
 CONF_HOMEASSISTANT_SERVICES = "homeassistant_services"
 CONF_HOMEASSISTANT_STATES = "homeassistant_states"
 CONF_LISTEN_BACKLOG = "listen_backlog"
+CONF_MIN_UPDATE_INTERVAL = "min_update_interval"
 CONF_MAX_SEND_QUEUE = "max_send_queue"
 CONF_STATE_SUBSCRIPTION_ONLY = "state_subscription_only"
 
@@ -281,6 +283,15 @@ CONFIG_SCHEMA = cv.All(
                 cv.positive_time_period_milliseconds,
                 cv.Range(max=cv.TimePeriod(milliseconds=65535)),
             ),
+            # Stretch the batch delay per connection when a client falls behind and
+            # collect per-connection batching statistics
+            cv.Optional(CONF_ADAPTIVE_BATCHING, default=False): cv.boolean,
+            # Minimum time between two state updates of the same entity to one client.
+            # Updates arriving faster are coalesced so the client always receives the latest value.
+            cv.Optional(CONF_MIN_UPDATE_INTERVAL, default="0ms"): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(max=cv.TimePeriod(milliseconds=65535)),
+            ),
             cv.Optional(CONF_CUSTOM_SERVICES, default=False): cv.boolean,
             cv.Optional(CONF_HOMEASSISTANT_SERVICES, default=False): cv.boolean,
             cv.Optional(CONF_HOMEASSISTANT_STATES, default=False): cv.boolean,
@@ -349,6 +360,11 @@ async def to_code(config: ConfigType) -> None:
         cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
     cg.add(var.set_batch_delay(config[CONF_BATCH_DELAY]))
+    if config[CONF_ADAPTIVE_BATCHING]:
+        cg.add_define("USE_API_ADAPTIVE_BATCHING")
+    if config[CONF_MIN_UPDATE_INTERVAL].total_milliseconds > 0:
+        cg.add_define("USE_API_MIN_UPDATE_INTERVAL")
+        cg.add(var.set_min_update_interval(config[CONF_MIN_UPDATE_INTERVAL]))
     if CONF_LISTEN_BACKLOG in config:
         cg.add(var.set_listen_backlog(config[CONF_LISTEN_BACKLOG]))
     if CONF_MAX_CONNECTIONS in config:
@@ -10,6 +10,7 @@
 #include "user_services.h"
 #endif
 #include <cerrno>
+#include <algorithm>
 #include <cinttypes>
 #include <functional>
 #include <limits>
@@ -118,7 +119,53 @@ APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *pa
 #endif
 }
 
-uint32_t APIConnection::get_batch_delay_ms_() const { return this->parent_->get_batch_delay(); }
+uint32_t APIConnection::get_batch_delay_ms_() const {
+#ifdef USE_API_ADAPTIVE_BATCHING
+  // During shutdown the server lowers the base delay to flush quickly; don't stretch it
+  if (this->parent_->is_shutting_down())
+    return this->parent_->get_batch_delay();
+  return this->parent_->get_batch_delay() + this->batch_delay_extra_ms_;
+#else
+  return this->parent_->get_batch_delay();
+#endif
+}
+
+#ifdef USE_API_ADAPTIVE_BATCHING
+void APIConnection::on_batch_backpressure_() {
+  // Multiplicative increase: the client (or the network) can't keep up, so give updates more time to coalesce
+  uint32_t extra = std::max<uint32_t>(this->batch_delay_extra_ms_ * 2u, ADAPTIVE_BATCH_STEP_MS);
+  this->batch_delay_extra_ms_ = std::min<uint32_t>(extra, ADAPTIVE_BATCH_MAX_EXTRA_MS);
+}
+
+void APIConnection::on_batch_sent_(size_t message_count) {
+  // The helper queues whatever the socket did not take and still reports success, so a full socket shows up as data
+  // left in its send queue rather than as WOULD_BLOCK
+  if (!this->helper_->can_write_without_blocking()) {
+    this->on_batch_backpressure_();
+    return;
+  }
+  // A batch that fills the packet-count limit means updates are arriving fast and batching is paying off;
+  // hold the current delay instead of shrinking it
+  if (message_count >= MAX_PACKETS_PER_BATCH)
+    return;
+  // Decay by a quarter per flushed batch towards the RTT floor
+  uint16_t extra = this->batch_delay_extra_ms_;
+  if (extra <= this->batch_delay_floor_ms_) {
+    this->batch_delay_extra_ms_ = this->batch_delay_floor_ms_;
+    return;
+  }
+  uint16_t step = std::max<uint16_t>(extra / 4, 1);
+  this->batch_delay_extra_ms_ = std::max<uint16_t>(extra - step, this->batch_delay_floor_ms_);
+}
+
+void APIConnection::update_batch_rtt_(uint32_t rtt_ms) {
+  // Sending faster than a fraction of the round-trip time only fills the client's receive window;
+  // a quarter RTT keeps latency low on a LAN while coalescing more on slow links (e.g. VPN or Wi-Fi repeaters)
+  this->batch_delay_floor_ms_ = std::min<uint32_t>(rtt_ms / 4, ADAPTIVE_BATCH_MAX_RTT_FLOOR_MS);
+  if (this->batch_delay_extra_ms_ < this->batch_delay_floor_ms_)
+    this->batch_delay_extra_ms_ = this->batch_delay_floor_ms_;
+}
+#endif
 
 void APIConnection::start() {
   this->last_traffic_ = App.get_loop_component_start_time();
@@ -216,6 +263,9 @@ void APIConnection::loop() {
   } else if (now - this->last_traffic_ > KEEPALIVE_TIMEOUT_MS && !this->flags_.remove) {
     // Only send ping if we're not disconnecting
     ESP_LOGVV(TAG, "Sending keepalive PING");
+#ifdef USE_API_ADAPTIVE_BATCHING
+    this->ping_sent_at_ = now;
+#endif
     PingRequest req;
     this->flags_.sent_ping = this->send_message(req, PingRequest::MESSAGE_TYPE);
     if (!this->flags_.sent_ping) {
@@ -1715,6 +1765,9 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint8_t message_type) {
     this->fatal_error_with_log_(LOG_STR("Packet write failed"), err);
     return false;
   }
+#ifdef USE_API_ADAPTIVE_BATCHING
+  this->record_packet_sent_(1, buffer.get_buffer()->size());
+#endif
   // Do not set last_traffic_ on send
   return true;
 }
@@ -1733,7 +1786,7 @@ void APIConnection::on_fatal_error() {
   this->flags_.remove = true;
 }
 
-void APIConnection::DeferredBatch::add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type,
+bool APIConnection::DeferredBatch::add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type,
                                             uint8_t estimated_size) {
   // Check if we already have a message of this type for this entity
   // This provides deduplication per entity/message_type combination
@@ -1742,12 +1795,13 @@ void APIConnection::DeferredBatch::add_item(EntityBase *entity, MessageCreator c
     if (item.entity == entity && item.message_type == message_type) {
       // Replace with new creator
       item.creator = creator;
-      return;
+      return true;
     }
   }
 
   // No existing item found, add new one
   items.emplace_back(entity, creator, message_type, estimated_size);
+  return false;
 }
 
 void APIConnection::DeferredBatch::add_item_front(EntityBase *entity, MessageCreator creator, uint8_t message_type,
@@ -1784,12 +1838,26 @@ void APIConnection::process_batch_() {
   // Try to clear buffer first
   if (!this->try_to_clear_buffer(true)) {
     // Can't write now, we'll try again later
+#ifdef USE_API_ADAPTIVE_BATCHING
+    this->on_batch_backpressure_();
+    // Restart the timer so the longer delay applies to this batch as well
+    this->deferred_batch_.batch_start_time = App.get_loop_component_start_time();
+#endif
     return;
   }
 
   // Get shared buffer reference once to avoid multiple calls
   auto &shared_buf = this->parent_->get_shared_buffer_ref();
   size_t num_items = this->deferred_batch_.size();
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+  const uint32_t now = App.get_loop_component_start_time();
+  num_items = this->partition_throttled_batch_(now);
+  if (num_items == 0) {
+    // Everything pending is throttled, check again after the next batch delay
+    this->deferred_batch_.batch_start_time = now;
+    return;
+  }
+#endif
 
   // Fast path for single message - allocate exact size needed
   if (num_items == 1) {
@@ -1805,11 +1873,17 @@ void APIConnection::process_batch_() {
       // It's safe to use the buffer for logging at this point regardless of send result
       this->log_batch_item_(item);
 #endif
-      this->clear_batch_();
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+      this->mark_update_sent_(item.entity, now);
+#endif
+      this->finish_batch_(1);
+#ifdef USE_API_ADAPTIVE_BATCHING
+      this->on_batch_sent_(1);
+#endif
     } else if (payload_size == 0) {
       // Message too large
       ESP_LOGW(TAG, "Message too large to send: type=%u", item.message_type);
-      this->clear_batch_();
+      this->finish_batch_(1);
     }
     return;
   }
@@ -1830,7 +1904,7 @@ void APIConnection::process_batch_() {
 
   // Pre-calculate exact buffer size needed based on message types
   uint32_t total_estimated_size = num_items * (header_padding + footer_size);
-  for (size_t i = 0; i < this->deferred_batch_.size(); i++) {
+  for (size_t i = 0; i < num_items; i++) {
     const auto &item = this->deferred_batch_[i];
     total_estimated_size += item.estimated_size;
   }
@@ -1883,7 +1957,8 @@ void APIConnection::process_batch_() {
   }
 
   if (items_processed == 0) {
-    this->deferred_batch_.clear();
+    // Drop the items that were tried, but keep any updates held back behind them
+    this->finish_batch_(num_items);
     return;
   }
 
@@ -1898,6 +1973,12 @@ void APIConnection::process_batch_() {
   if (err != APIError::OK && err != APIError::WOULD_BLOCK) {
     this->fatal_error_with_log_(LOG_STR("Batch write failed"), err);
   }
+#ifdef USE_API_ADAPTIVE_BATCHING
+  if (err == APIError::OK) {
+    this->record_packet_sent_(packet_count, shared_buf.size());
+    this->on_batch_sent_(packet_count);
+  }
+#endif
 
 #ifdef HAS_PROTO_MESSAGE_DUMP
   // Log messages after send attempt for VV debugging
@@ -1908,6 +1989,19 @@ void APIConnection::process_batch_() {
   }
 #endif
 
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+  if (err == APIError::OK) {
+    for (size_t i = 0; i < items_processed; i++) {
+      const auto &item = this->deferred_batch_[i];
+      this->mark_update_sent_(item.entity, now);
+    }
+  }
+#endif
+
+  this->finish_batch_(items_processed);
+}
+
+void APIConnection::finish_batch_(size_t items_processed) {
   // Handle remaining items more efficiently
   if (items_processed < this->deferred_batch_.size()) {
     // Remove processed items from the beginning
@@ -1920,6 +2014,57 @@ void APIConnection::process_batch_() {
   }
 }
 
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+bool APIConnection::is_update_throttled_(EntityBase *entity, uint8_t message_type, uint32_t now) {
+  // Only entity state updates after the initial sync are throttled; entity info, pings and disconnects are not
+  if (entity == nullptr || !this->list_entities_iterator_.completed() || !this->initial_state_iterator_.completed())
+    return false;
+#ifdef USE_EVENT
+  // Events are edge-triggered, every occurrence matters
+  if (message_type == EventResponse::MESSAGE_TYPE)
+    return false;
+#endif
+#ifdef USE_UPDATE
+  // Update entities report OTA progress while the main loop may be blocked
+  if (message_type == UpdateStateResponse::MESSAGE_TYPE)
+    return false;
+#endif
+  auto it = std::lower_bound(this->state_slots_.begin(), this->state_slots_.end(), entity,
+                             [](const StateSlot &slot, const EntityBase *e) { return slot.entity < e; });
+  if (it == this->state_slots_.end() || it->entity != entity)
+    return false;
+  return now - it->last_sent < this->parent_->get_min_update_interval();
+}
+
+void APIConnection::mark_update_sent_(EntityBase *entity, uint32_t now) {
+  if (entity == nullptr || !this->list_entities_iterator_.completed() || !this->initial_state_iterator_.completed())
+    return;
+  auto it = std::lower_bound(this->state_slots_.begin(), this->state_slots_.end(), entity,
+                             [](const StateSlot &slot, const EntityBase *e) { return slot.entity < e; });
+  if (it != this->state_slots_.end() && it->entity == entity) {
+    it->last_sent = now;
+  } else {
+    // First update for this entity; the table grows at most to the number of entities
+    this->state_slots_.insert(it, StateSlot{entity, now});
+  }
+}
+
+size_t APIConnection::partition_throttled_batch_(uint32_t now) {
+  auto &items = this->deferred_batch_.items;
+  // Keep the relative order on both sides, so a ping or disconnect at the front stays first. Batches are small, so
+  // each item is rotated past the held ones in place rather than with std::stable_partition, which may allocate.
+  auto send_end = items.begin();
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    if (this->is_update_throttled_(it->entity, it->message_type, now))
+      continue;
+    if (send_end != it)
+      std::rotate(send_end, it, it + 1);
+    ++send_end;
+  }
+  return send_end - items.begin();
+}
+#endif
+
 uint16_t APIConnection::MessageCreator::operator()(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
                                                    bool is_single, uint8_t message_type) const {
 #ifdef USE_EVENT
@@ -185,8 +185,24 @@ class APIConnection final : public APIServerConnection {
   void update_command(const UpdateCommandRequest &msg) override;
 #endif
 
+#ifdef USE_API_ADAPTIVE_BATCHING
+  // Per-connection batching statistics, logged in the API server config dump
+  struct BatchStats {
+    uint32_t packets{0};    // Socket writes; one write carries one or more messages
+    uint32_t messages{0};   // Protobuf messages written
+    uint32_t bytes{0};      // Bytes handed to the frame helper, including framing
+    uint32_t coalesced{0};  // Pending state messages replaced by a newer one before they were sent
+  };
+  const BatchStats &get_batch_stats() const { return this->batch_stats_; }
+  uint32_t get_effective_batch_delay() const { return this->get_batch_delay_ms_(); }
+#endif
+
   void on_disconnect_response(const DisconnectResponse &value) override;
   void on_ping_response(const PingResponse &value) override {
+#ifdef USE_API_ADAPTIVE_BATCHING
+    if (this->flags_.sent_ping)
+      this->update_batch_rtt_(App.get_loop_component_start_time() - this->ping_sent_at_);
+#endif
     // we initiated ping
     this->flags_.sent_ping = false;
   }
@@ -545,8 +561,8 @@ class APIConnection final : public APIServerConnection {
     // No pre-allocation - log connections never use batching, and for
     // connections that do, buffers are released after initial sync anyway
 
-    // Add item to the batch
-    void add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size);
+    // Add item to the batch, returns true if it replaced a pending item for the same entity/message_type
+    bool add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size);
     // Add item to the front of the batch (for high priority messages like ping)
     void add_item_front(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size);
 
@@ -576,6 +592,23 @@ class APIConnection final : public APIServerConnection {
   // DeferredBatch here (16 bytes, 4-byte aligned)
   DeferredBatch deferred_batch_;
 
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+  // Latest-value slots for min_update_interval: when each entity last had a state update sent to this client,
+  // sorted by entity pointer. Updates arriving inside the interval stay queued in deferred_batch_, which only
+  // keeps one item per entity and encodes the entity's current state when the item is finally sent, so a
+  // throttled or congested client always receives the newest value instead of every intermediate one.
+  struct StateSlot {
+    EntityBase *entity;
+    uint32_t last_sent;
+  };
+  std::vector<StateSlot> state_slots_;
+
+  bool is_update_throttled_(EntityBase *entity, uint8_t message_type, uint32_t now);
+  void mark_update_sent_(EntityBase *entity, uint32_t now);
+  // Move throttled items to the back of the batch, returns the number of items that may be sent now
+  size_t partition_throttled_batch_(uint32_t now);
+#endif
+
   // ConnectionState enum for type safety
   enum class ConnectionState : uint8_t {
     WAITING_FOR_HELLO = 0,
@@ -611,6 +644,29 @@ class APIConnection final : public APIServerConnection {
   // Total: 2 (flags) + 2 + 2 = 6 bytes, then 2 bytes padding to next 4-byte boundary
 
   uint32_t get_batch_delay_ms_() const;
+#ifdef USE_API_ADAPTIVE_BATCHING
+  // Adaptive batching: the configured batch_delay is the lower bound, and each connection adds its own extra delay.
+  // The extra delay doubles while the socket can't take more data and decays again once batches go out, but never
+  // below a floor derived from the measured keepalive round-trip time.
+  static constexpr uint16_t ADAPTIVE_BATCH_STEP_MS = 10;
+  static constexpr uint16_t ADAPTIVE_BATCH_MAX_EXTRA_MS = 250;
+  static constexpr uint16_t ADAPTIVE_BATCH_MAX_RTT_FLOOR_MS = 100;
+
+  void on_batch_backpressure_();
+  /// Call after a batch was written; backs off instead if part of it is still queued in the frame helper
+  void on_batch_sent_(size_t message_count);
+  void update_batch_rtt_(uint32_t rtt_ms);
+  void record_packet_sent_(size_t message_count, size_t bytes) {
+    this->batch_stats_.packets++;
+    this->batch_stats_.messages += message_count;
+    this->batch_stats_.bytes += bytes;
+  }
+
+  BatchStats batch_stats_;
+  uint32_t ping_sent_at_{0};
+  uint16_t batch_delay_extra_ms_{0};
+  uint16_t batch_delay_floor_ms_{0};
+#endif
   // Message will use 8 more bytes than the minimum size, and typical
   // MTU is 1500. Sometimes users will see as low as 1460 MTU.
   // If its IPv6 the header is 40 bytes, and if its IPv4
@@ -626,6 +682,8 @@ class APIConnection final : public APIServerConnection {
 
   bool schedule_batch_();
   void process_batch_();
+  // Drop the first items_processed items and reschedule if anything is left
+  void finish_batch_(size_t items_processed);
   void clear_batch_() {
     this->deferred_batch_.clear();
     this->flags_.batch_scheduled = false;
@@ -669,9 +727,17 @@ class APIConnection final : public APIServerConnection {
   bool send_message_smart_(EntityBase *entity, MessageCreatorPtr creator, uint8_t message_type,
                            uint8_t estimated_size) {
     if (this->should_send_immediately_(message_type) && this->helper_->can_write_without_blocking()) {
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+      const uint32_t now = App.get_loop_component_start_time();
+      if (this->is_update_throttled_(entity, message_type, now))
+        return this->schedule_message_(entity, creator, message_type, estimated_size);
+#endif
       // Now actually encode and send
       if (creator(entity, this, MAX_BATCH_PACKET_SIZE, true) &&
           this->send_buffer(ProtoWriteBuffer{&this->parent_->get_shared_buffer_ref()}, message_type)) {
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+        this->mark_update_sent_(entity, now);
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
         // Log the message in verbose mode
         this->log_proto_message_(entity, MessageCreator(creator), message_type);
@@ -690,9 +756,17 @@ class APIConnection final : public APIServerConnection {
   bool send_message_smart_(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size) {
     // Try to send immediately if message type should bypass batching and buffer has space
     if (this->should_send_immediately_(message_type) && this->helper_->can_write_without_blocking()) {
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+      const uint32_t now = App.get_loop_component_start_time();
+      if (this->is_update_throttled_(entity, message_type, now))
+        return this->schedule_message_(entity, creator, message_type, estimated_size);
+#endif
       // Now actually encode and send
       if (creator(entity, this, MAX_BATCH_PACKET_SIZE, true, message_type) &&
           this->send_buffer(ProtoWriteBuffer{&this->parent_->get_shared_buffer_ref()}, message_type)) {
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+        this->mark_update_sent_(entity, now);
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
         // Log the message in verbose mode
         this->log_proto_message_(entity, creator, message_type);
@@ -709,7 +783,12 @@ class APIConnection final : public APIServerConnection {
 
   // Helper function to schedule a deferred message with known message type
   bool schedule_message_(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size) {
+#ifdef USE_API_ADAPTIVE_BATCHING
+    if (this->deferred_batch_.add_item(entity, creator, message_type, estimated_size))
+      this->batch_stats_.coalesced++;
+#else
     this->deferred_batch_.add_item(entity, creator, message_type, estimated_size);
+#endif
     return this->schedule_batch_();
   }
 
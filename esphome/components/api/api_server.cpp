@@ -19,6 +19,7 @@
 #endif
 
 #include <algorithm>
+#include <cinttypes>
 #include <utility>
 
 namespace esphome::api {
@@ -222,6 +223,25 @@ void APIServer::dump_config() {
 #else
   ESP_LOGCONFIG(TAG, "  Noise encryption: NO");
 #endif
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+  ESP_LOGCONFIG(TAG, "  Min update interval: %u ms", this->min_update_interval_);
+#endif
+#ifdef USE_API_ADAPTIVE_BATCHING
+  ESP_LOGCONFIG(TAG, "  Adaptive batching: YES");
+  for (auto &c : this->clients_) {
+    const auto &stats = c->get_batch_stats();
+    // Report messages/packet in integer tenths to avoid float formatting
+    uint32_t msgs_per_packet_x10 = stats.packets == 0 ? 0 : stats.messages * 10 / stats.packets;
+    ESP_LOGCONFIG(TAG,
+                  "  Client %s:\n"
+                  "    Batch delay: %" PRIu32 " ms\n"
+                  "    Packets: %" PRIu32 ", messages/packet: %" PRIu32 ".%" PRIu32 "\n"
+                  "    Bytes/packet: %" PRIu32 "\n"
+                  "    Coalesced updates: %" PRIu32,
+                  c->get_peername().c_str(), c->get_effective_batch_delay(), stats.packets, msgs_per_packet_x10 / 10,
+                  msgs_per_packet_x10 % 10, stats.packets == 0 ? 0 : stats.bytes / stats.packets, stats.coalesced);
+  }
+#endif
 }
 
 #ifdef USE_API_PASSWORD
@@ -68,6 +68,11 @@ class APIServer : public Component,
   void set_reboot_timeout(uint32_t reboot_timeout);
   void set_batch_delay(uint16_t batch_delay);
   uint16_t get_batch_delay() const { return batch_delay_; }
+  bool is_shutting_down() const { return this->shutting_down_; }
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+  void set_min_update_interval(uint16_t min_update_interval) { this->min_update_interval_ = min_update_interval; }
+  uint16_t get_min_update_interval() const { return this->min_update_interval_; }
+#endif
   void set_listen_backlog(uint8_t listen_backlog) { this->listen_backlog_ = listen_backlog; }
   void set_max_connections(uint8_t max_connections) { this->max_connections_ = max_connections; }
 
@@ -285,6 +290,9 @@ class APIServer : public Component,
   // Group smaller types together
   uint16_t port_{6053};
   uint16_t batch_delay_{100};
+#ifdef USE_API_MIN_UPDATE_INTERVAL
+  uint16_t min_update_interval_{0};
+#endif
   // Connection limits - these defaults will be overridden by config values
   // from cv.SplitDefault in __init__.py which sets platform-specific defaults
   uint8_t listen_backlog_{4};
@@ -23,6 +23,9 @@ class ATCMiThermometer : public Component, public esp32_ble_tracker::ESPBTDevice
  public:
   void set_address(uint64_t address) { address_ = address; };
 
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override {
+    return advertisement.address_uint64() == this->address_;
+  }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   void dump_config() override;
   void set_temperature(sensor::Sensor *temperature) { temperature_ = temperature; }
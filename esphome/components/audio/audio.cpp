@@ -1,5 +1,7 @@
 #include "audio.h"
 
+#include "esphome/core/helpers.h"
+
 namespace esphome {
 namespace audio {
 
@@ -63,5 +65,25 @@ void scale_audio_samples(const int16_t *audio_samples, int16_t *output_buffer, i
   }
 }
 
+void add_audio_samples(const int16_t *first_samples, const int16_t *second_samples, int16_t *output_buffer,
+                       size_t samples_to_add) {
+  size_t i = 0;
+  // Four samples per iteration keeps the loads ahead of the dependent clamps and stores
+  for (; i + 4 <= samples_to_add; i += 4) {
+    int32_t sum0 = (int32_t) first_samples[i] + second_samples[i];
+    int32_t sum1 = (int32_t) first_samples[i + 1] + second_samples[i + 1];
+    int32_t sum2 = (int32_t) first_samples[i + 2] + second_samples[i + 2];
+    int32_t sum3 = (int32_t) first_samples[i + 3] + second_samples[i + 3];
+    output_buffer[i] = (int16_t) clamp<int32_t>(sum0, INT16_MIN, INT16_MAX);
+    output_buffer[i + 1] = (int16_t) clamp<int32_t>(sum1, INT16_MIN, INT16_MAX);
+    output_buffer[i + 2] = (int16_t) clamp<int32_t>(sum2, INT16_MIN, INT16_MAX);
+    output_buffer[i + 3] = (int16_t) clamp<int32_t>(sum3, INT16_MIN, INT16_MAX);
+  }
+  for (; i < samples_to_add; i++) {
+    int32_t sum = (int32_t) first_samples[i] + second_samples[i];
+    output_buffer[i] = (int16_t) clamp<int32_t>(sum, INT16_MIN, INT16_MAX);
+  }
+}
+
 }  // namespace audio
 }  // namespace esphome
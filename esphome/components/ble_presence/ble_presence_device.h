@@ -50,6 +50,22 @@ class BLEPresenceDevice : public binary_sensor::BinarySensorInitiallyOff,
     this->minimum_rssi_ = rssi;
   }
   void set_timeout(uint32_t timeout) { this->timeout_ = timeout; }
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override {
+    if (this->check_minimum_rssi_ && this->minimum_rssi_ > advertisement.get_scan_result().rssi)
+      return false;
+    switch (this->match_by_) {
+      case MATCH_BY_MAC_ADDRESS:
+        return advertisement.address_uint64() == this->address_;
+      case MATCH_BY_SERVICE_UUID:
+        return advertisement.has_service_uuid(this->uuid_);
+      case MATCH_BY_IBEACON_UUID:
+        // iBeacons are Apple manufacturer data
+        return advertisement.has_manufacturer_id(esp32_ble_tracker::ESPBTUUID::from_uint16(0x004C));
+      default:
+        // Resolving the IRK needs the parsed device
+        return true;
+    }
+  }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override {
     if (this->check_minimum_rssi_ && this->minimum_rssi_ > device.get_rssi()) {
       return false;
@@ -48,6 +48,20 @@ class BLERSSISensor : public sensor::Sensor, public esp32_ble_tracker::ESPBTDevi
       this->publish_state(NAN);
     this->found_ = false;
   }
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override {
+    switch (this->match_by_) {
+      case MATCH_BY_MAC_ADDRESS:
+        return advertisement.address_uint64() == this->address_;
+      case MATCH_BY_SERVICE_UUID:
+        return advertisement.has_service_uuid(this->uuid_);
+      case MATCH_BY_IBEACON_UUID:
+        // iBeacons are Apple manufacturer data
+        return advertisement.has_manufacturer_id(esp32_ble_tracker::ESPBTUUID::from_uint16(0x004C));
+      default:
+        // Resolving the IRK needs the parsed device
+        return true;
+    }
+  }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override {
     switch (this->match_by_) {
       case MATCH_BY_MAC_ADDRESS:
@@ -16,6 +16,10 @@ _LOGGER = logging.getLogger(__name__)
 CONF_CONNECTION_SLOTS = "connection_slots"
 CONF_CACHE_SERVICES = "cache_services"
 CONF_CONNECTIONS = "connections"
+CONF_ADVERTISEMENT_DEDUP = "advertisement_dedup"
+CONF_CACHE_SIZE = "cache_size"
+CONF_RSSI_THRESHOLD = "rssi_threshold"
+CONF_KEEP_ALIVE = "keep_alive"
 DEFAULT_CONNECTION_SLOTS = 3
 
 bluetooth_proxy_ns = cg.esphome_ns.namespace("bluetooth_proxy")
@@ -27,6 +31,18 @@ BluetoothConnection = bluetooth_proxy_ns.class_(
     "BluetoothConnection", esp32_ble_client.BLEClientBase
 )
 
+ADVERTISEMENT_DEDUP_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_CACHE_SIZE, default=64): cv.one_of(
+            16, 32, 64, 128, 256, int=True
+        ),
+        cv.Optional(CONF_RSSI_THRESHOLD, default=6): cv.int_range(min=1, max=100),
+        cv.Optional(
+            CONF_KEEP_ALIVE, default="10s"
+        ): cv.positive_time_period_milliseconds,
+    }
+)
+
 CONNECTION_SCHEMA = esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA.extend(
     {
         cv.GenerateID(): cv.declare_id(BluetoothConnection),
@@ -69,6 +85,7 @@ CONFIG_SCHEMA = cv.All(
                     cv.ensure_list(CONNECTION_SCHEMA),
                     cv.Length(min=1, max=esp32_ble.IDF_MAX_CONNECTIONS),
                 ),
+                cv.Optional(CONF_ADVERTISEMENT_DEDUP): ADVERTISEMENT_DEDUP_SCHEMA,
             }
         )
         .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
@@ -98,6 +115,14 @@ async def to_code(config):
     # This achieves ~97% WiFi MTU utilization while staying under the limit
     cg.add_define("BLUETOOTH_PROXY_ADVERTISEMENT_BATCH_SIZE", 16)
 
+    if dedup_config := config.get(CONF_ADVERTISEMENT_DEDUP):
+        cg.add_define(
+            "BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE",
+            dedup_config[CONF_CACHE_SIZE],
+        )
+        cg.add(var.set_dedup_rssi_threshold(dedup_config[CONF_RSSI_THRESHOLD]))
+        cg.add(var.set_dedup_keep_alive(dedup_config[CONF_KEEP_ALIVE]))
+
     for connection_conf in config.get(CONF_CONNECTIONS, []):
         connection_var = cg.new_Pvariable(connection_conf[CONF_ID])
         await cg.register_component(connection_var, connection_conf)
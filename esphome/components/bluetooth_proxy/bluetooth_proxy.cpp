@@ -3,6 +3,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 #include "esphome/core/application.h"
+#include <cinttypes>
+#include <cstdlib>
 #include <cstring>
 
 #ifdef USE_ESP32
@@ -79,9 +81,16 @@ bool BluetoothProxy::parse_devices(const esp32_ble::BLEScanResult *scan_results,
     return false;
 
   auto &advertisements = this->response_.advertisements;
+#ifdef BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE
+  const uint32_t now = millis();
+#endif
 
   for (size_t i = 0; i < count; i++) {
     auto &result = scan_results[i];
+#ifdef BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE
+    if (!this->should_forward_advertisement_(result, now))
+      continue;
+#endif
     uint8_t length = result.adv_data_len + result.scan_rsp_len;
 
     // Fill in the data directly at current position
@@ -120,12 +129,65 @@ void BluetoothProxy::flush_pending_advertisements() {
   this->response_.advertisements_len = 0;
 }
 
+#ifdef BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE
+// Number of consecutive cache slots searched for an address before the oldest one is replaced
+static constexpr size_t ADVERTISEMENT_CACHE_PROBES = 4;
+
+bool BluetoothProxy::should_forward_advertisement_(const esp32_ble::BLEScanResult &result, uint32_t now) {
+  // With active scanning a device alternates between results with and without a scan response, so each kind gets
+  // its own entry; the flag sits above the 48 address bits
+  const uint64_t key = esp32_ble::ble_addr_to_uint64(result.bda) | (uint64_t(result.scan_rsp_len != 0) << 48);
+  // FNV-1a over the payload; the address type is included as it changes how the address is interpreted
+  uint32_t hash = 2166136261UL ^ result.ble_addr_type;
+  const uint8_t length = result.adv_data_len + result.scan_rsp_len;
+  for (uint8_t i = 0; i != length; i++)
+    hash = (hash ^ result.ble_adv[i]) * 16777619UL;
+
+  // Fibonacci hashing of the key selects the first slot of the probe window
+  const size_t mask = BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE - 1;
+  const size_t start = static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+  AdvertisementCacheEntry *victim = nullptr;
+  for (size_t probe = 0; probe != ADVERTISEMENT_CACHE_PROBES; probe++) {
+    auto &entry = this->advertisement_cache_[(start + probe) & mask];
+    if (entry.key == key) {
+      if (entry.payload_hash == hash && std::abs(result.rssi - entry.rssi) < this->dedup_rssi_threshold_ &&
+          now - entry.last_forwarded < this->dedup_keep_alive_) {
+        this->suppressed_advertisements_++;
+        return false;
+      }
+      victim = &entry;
+      break;
+    }
+    if (entry.key == 0) {
+      // Entries are never removed one by one, so the key can't be further along the window
+      victim = &entry;
+      break;
+    }
+    if (victim == nullptr || now - entry.last_forwarded > now - victim->last_forwarded)
+      victim = &entry;
+  }
+  victim->key = key;
+  victim->payload_hash = hash;
+  victim->rssi = result.rssi;
+  victim->last_forwarded = now;
+  this->forwarded_advertisements_++;
+  return true;
+}
+#endif
+
 void BluetoothProxy::dump_config() {
   ESP_LOGCONFIG(TAG,
                 "Bluetooth Proxy:\n"
                 "  Active: %s\n"
                 "  Connections: %d",
                 YESNO(this->active_), this->connection_count_);
+#ifdef BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE
+  ESP_LOGCONFIG(TAG,
+                "  Advertisement dedup: %d entries, RSSI threshold %u dB, keep-alive %" PRIu32 " ms\n"
+                "  Advertisements forwarded: %" PRIu32 ", suppressed: %" PRIu32,
+                BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE, this->dedup_rssi_threshold_, this->dedup_keep_alive_,
+                this->forwarded_advertisements_, this->suppressed_advertisements_);
+#endif
 }
 
 void BluetoothProxy::loop() {
@@ -368,6 +430,10 @@ void BluetoothProxy::subscribe_api_connection(api::APIConnection *api_connection
   }
   this->api_connection_ = api_connection;
   this->parent_->recalculate_advertisement_parser_types();
+#ifdef BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE
+  // A new subscriber has seen none of the cached advertisements yet
+  this->advertisement_cache_.fill({});
+#endif
 
   this->send_bluetooth_scanner_state_(this->parent_->get_scanner_state());
 }
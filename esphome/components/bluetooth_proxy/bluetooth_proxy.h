@@ -59,6 +59,8 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener,
  public:
   BluetoothProxy();
 #ifdef USE_ESP32_BLE_DEVICE
+  // Only raw advertisements are forwarded, so parsed devices are never needed
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override { return false; }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 #endif
   bool parse_devices(const esp32_ble::BLEScanResult *scan_results, size_t count) override;
@@ -66,6 +68,12 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener,
   void setup() override;
   void loop() override;
   void flush_pending_advertisements();
+#ifdef BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE
+  /// Forward a repeated advertisement again once its RSSI moved by at least this many dB.
+  void set_dedup_rssi_threshold(uint8_t threshold) { this->dedup_rssi_threshold_ = threshold; }
+  /// Forward a repeated advertisement again after this many milliseconds.
+  void set_dedup_keep_alive(uint32_t keep_alive) { this->dedup_keep_alive_ = keep_alive; }
+#endif
   esp32_ble_tracker::AdvertisementParserType get_advertisement_parser_type() override;
 
   void register_connection(BluetoothConnection *connection) {
@@ -152,6 +160,10 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener,
   void log_connection_info_(BluetoothConnection *connection, const char *message);
   void log_not_connected_gatt_(const char *action, const char *type);
   void handle_gatt_not_connected_(uint64_t address, uint16_t handle, const char *action, const char *type);
+#ifdef BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE
+  /// Check an advertisement against the dedup cache and update the cache if it is forwarded.
+  bool should_forward_advertisement_(const esp32_ble::BLEScanResult &result, uint32_t now);
+#endif
 
   // Memory optimized layout for 32-bit systems
   // Group 1: Pointers (4 bytes each, naturally aligned)
@@ -163,6 +175,21 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener,
   // BLE advertisement batching
   api::BluetoothLERawAdvertisementsResponse response_;
 
+#ifdef BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE
+  // Last forwarded advertisement per address and scan response presence; key 0 marks an empty slot
+  struct AdvertisementCacheEntry {
+    uint64_t key;
+    uint32_t payload_hash;
+    uint32_t last_forwarded;
+    int8_t rssi;
+  };
+  std::array<AdvertisementCacheEntry, BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE> advertisement_cache_{};
+  uint32_t forwarded_advertisements_{0};
+  uint32_t suppressed_advertisements_{0};
+  uint32_t dedup_keep_alive_{10000};
+  uint8_t dedup_rssi_threshold_{6};
+#endif
+
   // Group 3: 4-byte types
   uint32_t last_advertisement_flush_time_{0};
 
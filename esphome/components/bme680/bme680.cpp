@@ -236,16 +236,24 @@ void BME680Component::dump_config() {
 float BME680Component::get_setup_priority() const { return setup_priority::DATA; }
 
 void BME680Component::update() {
+  if (this->measure_transaction_.is_pending() || this->data_transaction_.is_pending())
+    return;
+
   uint8_t meas_control = 0;  // No need to fetch, we're setting all fields
   meas_control |= (this->temperature_oversampling_ & 0b111) << 5;
   meas_control |= (this->pressure_oversampling_ & 0b111) << 2;
   meas_control |= 0b01;  // forced mode
-  if (!this->write_byte(BME680_REGISTER_CONTROL_MEAS, meas_control)) {
+  this->measure_transaction_.clear();
+  this->measure_transaction_.write_register(BME680_REGISTER_CONTROL_MEAS, &meas_control, 1);
+  auto err = this->submit(&this->measure_transaction_, [this](i2c::ErrorCode err) {
+    if (err != i2c::ERROR_OK) {
+      this->status_set_warning();
+      return;
+    }
+    this->set_timeout("data", this->calc_meas_duration_(), [this]() { this->read_data_(); });
+  });
+  if (err != i2c::ERROR_OK)
     this->status_set_warning();
-    return;
-  }
-
-  this->set_timeout("data", this->calc_meas_duration_(), [this]() { this->read_data_(); });
 }
 
 uint8_t BME680Component::calc_heater_resistance_(uint16_t temperature) {
@@ -296,8 +304,16 @@ uint8_t BME680Component::calc_heater_duration_(uint16_t duration) {
   return duration_value;
 }
 void BME680Component::read_data_() {
-  uint8_t data[15];
-  if (!this->read_bytes(BME680_REGISTER_FIELD0, data, 15)) {
+  this->data_transaction_.clear();
+  this->data_transaction_.read_register(BME680_REGISTER_FIELD0, this->data_, sizeof(this->data_));
+  auto err = this->submit(&this->data_transaction_, [this](i2c::ErrorCode err) { this->publish_data_(err); });
+  if (err != i2c::ERROR_OK)
+    this->publish_data_(err);
+}
+
+void BME680Component::publish_data_(i2c::ErrorCode err) {
+  const uint8_t *data = this->data_;
+  if (err != i2c::ERROR_OK) {
     if (this->temperature_sensor_ != nullptr)
       this->temperature_sensor_->publish_state(NAN);
     if (this->pressure_sensor_ != nullptr)
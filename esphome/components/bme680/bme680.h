@@ -109,6 +109,8 @@ class BME680Component : public PollingComponent, public i2c::I2CDevice {
   uint8_t calc_heater_duration_(uint16_t duration);
   /// Read data from the BME680 and publish results.
   void read_data_();
+  /// Publish the results of a data read that finished with err.
+  void publish_data_(i2c::ErrorCode err);
 
   /// Calculate the temperature in °C using the provided raw ADC value.
   float calc_temperature_(uint32_t raw_temperature);
@@ -129,6 +131,10 @@ class BME680Component : public PollingComponent, public i2c::I2CDevice {
   uint16_t heater_temperature_{320};
   uint16_t heater_duration_{150};
 
+  i2c::I2CTransaction measure_transaction_;
+  i2c::I2CTransaction data_transaction_;
+  uint8_t data_[15];
+
   sensor::Sensor *temperature_sensor_{nullptr};
   sensor::Sensor *pressure_sensor_{nullptr};
   sensor::Sensor *humidity_sensor_{nullptr};
@@ -25,6 +25,11 @@ from esphome.const import (
 
 DEPENDENCIES = ["i2c"]
 
+
+def AUTO_LOAD() -> list[str]:
+    return i2c.async_transactions_auto_load()
+
+
 bme680_ns = cg.esphome_ns.namespace("bme680")
 BME680Oversampling = bme680_ns.enum("BME680Oversampling")
 OVERSAMPLING_OPTIONS = {
@@ -129,6 +134,7 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     await i2c.register_i2c_device(var, config)
+    i2c.request_async_transactions()
 
     if temperature_config := config.get(CONF_TEMPERATURE):
         sens = await sensor.new_sensor(temperature_config)
@@ -86,12 +86,24 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_run(x, y, width, color); }
+
+void HOT Display::fill_run(int x, int y, int width, Color color) {
   for (int i = x; i < x + width; i++)
     this->draw_pixel_at(i, y, color);
 }
 
+void HOT Display::blend_run(int x, int y, int width, const uint8_t *alpha, Color color, Color background) {
+  for (int i = 0; i < width; i++) {
+    uint8_t a = alpha[i];
+    if (a == 255) {
+      this->draw_pixel_at(x + i, y, color);
+    } else if (a != 0) {
+      this->draw_pixel_at(x + i, y, blend_color(color, background, a));
+    }
+  }
+}
+
 void HOT Display::vertical_line(int x, int y, int height, Color color) {
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = y; i < y + height; i++)
@@ -106,9 +118,8 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
 }
 
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
   for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+    this->fill_run(x1, i, width, color);
   }
 }
 
@@ -779,6 +790,27 @@ bool Display::clip(int x, int y) {
   return true;
 }
 
+bool Display::clip_run_(int &x, int y, int &width, int &skip) {
+  if (y < 0 || y >= this->get_height())
+    return false;
+  int x1 = std::max(x, 0);
+  int x2 = std::min(x + width, this->get_width());
+  // Same rules as draw_pixel_at(): an unset clipping rectangle doesn't clip
+  auto clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    if (y < clipping.y || y >= clipping.y2())
+      return false;
+    x1 = std::max(x1, (int) clipping.x);
+    x2 = std::min(x2, (int) clipping.x2());
+  }
+  if (x1 >= x2)
+    return false;
+  skip = x1 - x;
+  x = x1;
+  width = x2 - x1;
+  return true;
+}
+
 bool Display::clamp_x_(int x, int w, int &min_x, int &max_x) {
   min_x = std::max(x, 0);
   max_x = std::min(x + w, this->get_width());
@@ -302,6 +302,13 @@ extern const Color COLOR_OFF;
 /// Turn the pixel ON.
 extern const Color COLOR_ON;
 
+/// Blend color over background with the given coverage (0 gives background, 255 gives color).
+inline Color blend_color(Color color, Color background, uint8_t alpha) {
+  auto mix = [alpha](uint8_t fg, uint8_t bg) -> uint8_t { return bg + ((int) fg - (int) bg) * alpha / 255; };
+  return Color(mix(color.r, background.r), mix(color.g, background.g), mix(color.b, background.b),
+               mix(color.w, background.w));
+}
+
 class BaseImage {
  public:
   virtual void draw(int x, int y, Display *display, Color color_on, Color color_off) = 0;
@@ -366,6 +373,20 @@ class Display : public PollingComponent {
     this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
   }
 
+  /** Fill the horizontal run of pixels from [x,y] to [x+width-1,y] with the given color.
+   *
+   * The default implementation calls draw_pixel_at() for every pixel. Displays with a frame buffer override this to
+   * clip, rotate and convert the color once per run instead of once per pixel.
+   */
+  virtual void fill_run(int x, int y, int width, Color color);
+
+  /** Draw a horizontal run of pixels from [x,y] to [x+width-1,y] through a coverage mask.
+   *
+   * For every pixel alpha[i] selects what is drawn: 0 leaves the pixel untouched, 255 draws color and values in
+   * between draw color blended over background. Used for anti-aliased glyphs and alpha images.
+   */
+  virtual void blend_run(int x, int y, int width, const uint8_t *alpha, Color color, Color background);
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
@@ -769,6 +790,12 @@ class Display : public PollingComponent {
  protected:
   bool clamp_x_(int x, int w, int &min_x, int &max_x);
   bool clamp_y_(int y, int h, int &min_y, int &max_y);
+  /** Clip a horizontal run to the display and the clipping region.
+   *
+   * On success x and width describe the visible part and skip is the number of pixels cut off at the start.
+   * Returns false if nothing of the run is visible.
+   */
+  bool clip_run_(int &x, int y, int &width, int &skip);
   void vprintf_(int x, int y, BaseFont *font, Color color, Color background, TextAlign align, const char *format,
                 va_list arg);
 
@@ -48,6 +48,42 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   if (!this->get_clipping().inside(x, y))
     return;  // NOLINT
 
+  this->rotate_to_native_(x, y);
+  this->draw_absolute_pixel_internal(x, y, color);
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::fill_run(int x, int y, int width, Color color) {
+  int skip;
+  if (!this->clip_run_(x, y, width, skip))
+    return;
+  for (int i = 0; i != width; i++) {
+    int native_x = x + i;
+    int native_y = y;
+    this->rotate_to_native_(native_x, native_y);
+    this->draw_absolute_pixel_internal(native_x, native_y, color);
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::blend_run(int x, int y, int width, const uint8_t *alpha, Color color, Color background) {
+  int skip;
+  if (!this->clip_run_(x, y, width, skip))
+    return;
+  alpha += skip;
+  for (int i = 0; i != width; i++) {
+    uint8_t a = alpha[i];
+    if (a == 0)
+      continue;
+    int native_x = x + i;
+    int native_y = y;
+    this->rotate_to_native_(native_x, native_y);
+    this->draw_absolute_pixel_internal(native_x, native_y, a == 255 ? color : blend_color(color, background, a));
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::rotate_to_native_(int &x, int &y) {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_0_DEGREES:
       break;
@@ -64,8 +100,6 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
       y = this->get_height_internal() - y - 1;
       break;
   }
-  this->draw_absolute_pixel_internal(x, y, color);
-  App.feed_wdt();
 }
 
 }  // namespace display
@@ -22,9 +22,15 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  void fill_run(int x, int y, int width, Color color) override;
+  void blend_run(int x, int y, int width, const uint8_t *alpha, Color color, Color background) override;
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /// Map rotated (user) coordinates to the native coordinates of the display.
+  void rotate_to_native_(int &x, int &y);
+
   void init_internal_(uint32_t buffer_length);
 
   uint8_t *buffer_{nullptr};
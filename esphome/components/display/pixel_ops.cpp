@@ -0,0 +1,77 @@
+#include "pixel_ops.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace display {
+namespace pixel_ops {
+
+static inline uint16_t swap16(uint16_t value) { return value >> 8 | value << 8; }
+
+void HOT fill_24(uint8_t *dst, uint8_t b0, uint8_t b1, uint8_t b2, size_t count) {
+  if (count == 0)
+    return;
+  dst[0] = b0;
+  dst[1] = b1;
+  dst[2] = b2;
+  // Double the filled prefix until the run is complete, so the bulk of the work is done by memcpy
+  const size_t total = count * 3;
+  size_t filled = 3;
+  while (filled < total) {
+    size_t chunk = std::min(filled, total - filled);
+    memcpy(dst + filled, dst, chunk);
+    filled += chunk;
+  }
+}
+
+void HOT rgb565_to_rgb666(uint8_t *dst, const uint16_t *src, size_t count, bool big_endian) {
+  for (size_t i = 0; i != count; i++) {
+    uint16_t value = big_endian ? swap16(src[i]) : src[i];
+    *dst++ = (value >> 8) & 0xF8;
+    *dst++ = (value & 0x7E0) >> 3;
+    *dst++ = value << 3;
+  }
+}
+
+void HOT rgb332_to_bgr666(uint8_t *dst, const uint8_t *src, size_t count) {
+  for (size_t i = 0; i != count; i++) {
+    uint8_t value = src[i];
+    *dst++ = value << 6;
+    *dst++ = (value & 0x1C) << 3;
+    *dst++ = value & 0xE0;
+  }
+}
+
+void HOT rgb332_to_rgb565(uint8_t *dst, const uint8_t *src, size_t count, bool big_endian) {
+  const size_t hi = big_endian ? 0 : 1;
+  for (size_t i = 0; i != count; i++, dst += 2) {
+    uint8_t value = src[i];
+    dst[hi] = (value & 0xE0) | ((value & 0x1C) >> 2);
+    dst[hi ^ 1] = (value & 3) << 3;
+  }
+}
+
+void HOT blend_rgb565(uint16_t *dst, const uint8_t *alpha, Color color, Color background, size_t count,
+                      bool big_endian) {
+  const uint16_t solid = color_to_rgb565(color, big_endian);
+  const int dr = (int) color.r - (int) background.r;
+  const int dg = (int) color.g - (int) background.g;
+  const int db = (int) color.b - (int) background.b;
+  for (size_t i = 0; i != count; i++) {
+    const uint8_t a = alpha[i];
+    if (a == 255) {
+      dst[i] = solid;
+    } else if (a != 0) {
+      // Same arithmetic as blend_color(), so the result is bit-identical to the per-pixel path
+      Color mixed(background.r + dr * a / 255, background.g + dg * a / 255, background.b + db * a / 255);
+      dst[i] = color_to_rgb565(mixed, big_endian);
+    }
+  }
+}
+
+}  // namespace pixel_ops
+}  // namespace display
+}  // namespace esphome
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/core/color.h"
+
+namespace esphome {
+namespace display {
+
+/** Row kernels shared by the framebuffer based display drivers.
+ *
+ * All kernels work on a run of count pixels and produce exactly the same bytes as the per-pixel conversions they
+ * replace. A big_endian flag means the 16-bit pixels are stored byte-swapped, i.e. high byte first in memory, which is
+ * what most SPI panels expect. The kernels are written as straight-line loops that the compiler can unroll.
+ */
+namespace pixel_ops {
+
+/// Pack a color into an RGB565 pixel, optionally byte-swapped.
+inline uint16_t color_to_rgb565(Color color, bool big_endian) {
+  uint16_t value = (color.r & 0xF8) << 8 | (color.g & 0xFC) << 3 | color.b >> 3;
+  return big_endian ? static_cast<uint16_t>(value >> 8 | value << 8) : value;
+}
+
+/// Set count 3-byte pixels to the bytes b0, b1, b2.
+void fill_24(uint8_t *dst, uint8_t b0, uint8_t b1, uint8_t b2, size_t count);
+
+/// Expand RGB565 pixels to 18-bit color, three bytes per pixel in red, green, blue order with the bits left aligned.
+void rgb565_to_rgb666(uint8_t *dst, const uint16_t *src, size_t count, bool big_endian);
+
+/// Expand RGB332 pixels to 18-bit color, three bytes per pixel in blue, green, red order with the bits left aligned.
+void rgb332_to_bgr666(uint8_t *dst, const uint8_t *src, size_t count);
+
+/// Expand RGB332 pixels to RGB565, written as two bytes per pixel in the requested byte order.
+void rgb332_to_rgb565(uint8_t *dst, const uint8_t *src, size_t count, bool big_endian);
+
+/**
+ * Blend color over background through a coverage mask and store the result as RGB565.
+ * The result matches color_to_rgb565(blend_color(color, background, alpha[i])); pixels with zero coverage are left
+ * untouched.
+ */
+void blend_rgb565(uint16_t *dst, const uint8_t *alpha, Color color, Color background, size_t count,
+                  bool big_endian);
+
+}  // namespace pixel_ops
+}  // namespace display
+}  // namespace esphome
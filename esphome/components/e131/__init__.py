@@ -3,6 +3,7 @@ from esphome.components.light.effects import register_addressable_effect
 from esphome.components.light.types import AddressableLightEffect
 import esphome.config_validation as cv
 from esphome.const import CONF_CHANNELS, CONF_ID, CONF_METHOD, CONF_NAME
+from esphome.core import CORE
 
 AUTO_LOAD = ["socket"]
 DEPENDENCIES = ["network"]
@@ -23,11 +24,13 @@ CHANNELS = {
 
 CONF_UNIVERSE = "universe"
 CONF_E131_ID = "e131_id"
+CONF_DDP = "ddp"
 
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(E131Component),
         cv.Optional(CONF_METHOD, default="MULTICAST"): cv.one_of(*METHODS, upper=True),
+        cv.Optional(CONF_DDP, default=False): cv.boolean,
     }
 )
 
@@ -36,6 +39,14 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     cg.add(var.set_method(METHODS[config[CONF_METHOD]]))
+    if config[CONF_DDP]:
+        cg.add(var.set_ddp(True))
+    if CORE.is_esp32:
+        # Packets are received on a task that wakes the main loop once a frame is complete
+        cg.add_define("USE_E131_TASK")
+        from esphome.components import socket
+
+        socket.require_wake_loop_threadsafe()
 
 
 @register_addressable_effect(
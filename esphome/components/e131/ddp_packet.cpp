@@ -0,0 +1,49 @@
+#include "e131.h"
+#ifdef USE_NETWORK
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace e131 {
+
+// DDP (Distributed Display Protocol), see http://www.3waylabs.com/ddp/
+static const size_t DDP_HEADER_SIZE = 10;
+static const size_t DDP_TIMECODE_SIZE = 4;
+
+static const uint8_t DDP_FLAGS_VERSION_MASK = 0xC0;
+static const uint8_t DDP_FLAGS_VERSION_1 = 0x40;
+static const uint8_t DDP_FLAG_TIMECODE = 0x10;
+static const uint8_t DDP_FLAG_STORAGE = 0x08;
+static const uint8_t DDP_FLAG_REPLY = 0x04;
+static const uint8_t DDP_FLAG_QUERY = 0x02;
+static const uint8_t DDP_FLAG_PUSH = 0x01;
+
+static const uint8_t DDP_ID_DISPLAY = 1;
+static const uint8_t DDP_ID_ALL = 255;
+
+bool E131Component::ddp_packet_(const uint8_t *data, size_t len, DDPPacket &packet) {
+  if (len < DDP_HEADER_SIZE)
+    return false;
+
+  const uint8_t flags = data[0];
+  if ((flags & DDP_FLAGS_VERSION_MASK) != DDP_FLAGS_VERSION_1)
+    return false;
+  // Queries, replies and stored configurations are not pixel data
+  if (flags & (DDP_FLAG_STORAGE | DDP_FLAG_REPLY | DDP_FLAG_QUERY))
+    return false;
+  if (data[3] != DDP_ID_DISPLAY && data[3] != DDP_ID_ALL)
+    return false;
+
+  const size_t header_size = (flags & DDP_FLAG_TIMECODE) ? DDP_HEADER_SIZE + DDP_TIMECODE_SIZE : DDP_HEADER_SIZE;
+  packet.offset = encode_uint32(data[4], data[5], data[6], data[7]);
+  packet.count = encode_uint16(data[8], data[9]);
+  if (header_size + packet.count > len)
+    return false;
+
+  packet.values = data + header_size;
+  packet.push = flags & DDP_FLAG_PUSH;
+  return true;
+}
+
+}  // namespace e131
+}  // namespace esphome
+#endif
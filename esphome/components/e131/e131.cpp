@@ -5,11 +5,20 @@
 
 #include <algorithm>
 
+#ifdef USE_E131_TASK
+#include "esphome/core/application.h"
+
+#include <sys/select.h>
+#endif
+
 namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+static const int DDP_PORT = 4048;
+/// Datagrams handled per loop() when there is no receive task, so a flood cannot stall the main loop
+static const int MAX_PACKETS_PER_LOOP = 32;
 
 E131Component::E131Component() {}
 
@@ -17,65 +26,165 @@ E131Component::~E131Component() {
   if (this->socket_) {
     this->socket_->close();
   }
+  if (this->ddp_socket_) {
+    this->ddp_socket_->close();
+  }
 }
 
 void E131Component::setup() {
-  this->socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+  this->socket_ = this->open_socket_(PORT);
+  if (this->socket_ == nullptr) {
+    this->mark_failed();
+    return;
+  }
+  if (this->ddp_) {
+    this->ddp_socket_ = this->open_socket_(DDP_PORT);
+    if (this->ddp_socket_ == nullptr) {
+      this->mark_failed();
+      return;
+    }
+  }
+
+  join_igmp_groups_();
+
+#ifdef USE_E131_TASK
+  if (this->socket_->get_fd() < 0 || (this->ddp_socket_ != nullptr && this->ddp_socket_->get_fd() < 0))
+    return;  // the task waits on file descriptors; without them the sockets are polled from loop()
+  // Above the main loop, so that universes are written into the lights as they arrive
+  BaseType_t result =
+      xTaskCreate(receive_task_func, "e131_rx", 3584, this, tskIDLE_PRIORITY + 2, &this->receive_task_handle_);
+  if (result != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create receive task");
+    this->receive_task_handle_ = nullptr;
+    return;
+  }
+  // The task wakes the loop when a frame is complete
+  this->disable_loop();
+#endif
+}
+
+std::unique_ptr<socket::Socket> E131Component::open_socket_(uint16_t port) {
+  auto sock = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+  if (sock == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket");
+    return nullptr;
+  }
 
   int enable = 1;
-  int err = this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  int err = sock->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to set reuseaddr: errno %d", err);
     // we can still continue
   }
-  err = this->socket_->setblocking(false);
+  err = sock->setblocking(false);
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", err);
-    this->mark_failed();
-    return;
+    return nullptr;
   }
 
   struct sockaddr_storage server;
 
-  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), PORT);
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), port);
   if (sl == 0) {
     ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
-    this->mark_failed();
-    return;
+    return nullptr;
   }
 
-  err = this->socket_->bind((struct sockaddr *) &server, sizeof(server));
+  err = sock->bind((struct sockaddr *) &server, sizeof(server));
   if (err != 0) {
-    ESP_LOGW(TAG, "Socket unable to bind: errno %d", errno);
-    this->mark_failed();
-    return;
+    ESP_LOGW(TAG, "Socket unable to bind to port %u: errno %d", port, errno);
+    return nullptr;
   }
-
-  join_igmp_groups_();
+  return sock;
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
-  E131Packet packet;
-  int universe = 0;
+#ifdef USE_E131_TASK
+  if (this->receive_task_handle_ != nullptr) {
+    this->show_frames_();
+    this->disable_loop();
+    return;
+  }
+#endif
+  this->receive_();
+  this->show_frames_();
+}
+
+void E131Component::receive_() {
   uint8_t buf[1460];
+  bool e131_done = false;
+  bool ddp_done = this->ddp_socket_ == nullptr;
 
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
-    return;
+  for (int i = 0; i < MAX_PACKETS_PER_LOOP && !(e131_done && ddp_done); i++) {
+    if (!e131_done) {
+      ssize_t len = this->socket_->read(buf, sizeof(buf));
+      if (len < 0) {
+        e131_done = true;
+      } else {
+        int universe = 0;
+        E131Packet packet;
+        if (!this->packet_(buf, len, universe, packet)) {
+          ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+        } else if (!this->process_(universe, packet)) {
+          ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+        }
+      }
+    }
+    if (!ddp_done) {
+      ssize_t len = this->ddp_socket_->read(buf, sizeof(buf));
+      if (len < 0) {
+        ddp_done = true;
+      } else {
+        DDPPacket packet;
+        if (!this->ddp_packet_(buf, len, packet)) {
+          ESP_LOGV(TAG, "Invalid DDP packet received of size %zd.", len);
+        } else if (!this->process_ddp_(packet)) {
+          ESP_LOGV(TAG, "Ignored DDP packet at offset %" PRIu32 " of size %u.", packet.offset, packet.count);
+        }
+      }
+    }
   }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
+}
 
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
-    return;
+void E131Component::show_frames_() {
+  // Only the main loop changes light_effects_, so it can be read here without the lock
+  for (auto *light_effect : light_effects_) {
+    if (light_effect->show_pending_.exchange(false))
+      light_effect->get_addressable_()->schedule_show();
   }
+}
+
+#ifdef USE_E131_TASK
+void E131Component::receive_task_func(void *param) {
+  auto *self = static_cast<E131Component *>(param);
+  const int fd = self->socket_->get_fd();
+  const int ddp_fd = self->ddp_socket_ == nullptr ? -1 : self->ddp_socket_->get_fd();
+
+  // Run forever - task lifecycle matches component lifecycle
+  while (true) {
+    fd_set read_fds;
+    FD_ZERO(&read_fds);
+    FD_SET(fd, &read_fds);
+    if (ddp_fd >= 0)
+      FD_SET(ddp_fd, &read_fds);
+    struct timeval timeout = {1, 0};
+    if (::select(std::max(fd, ddp_fd) + 1, &read_fds, nullptr, nullptr, &timeout) <= 0)
+      continue;
 
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+    self->receive_();
+    bool show = false;
+    {
+      LockGuard guard(self->lock_);
+      for (auto *light_effect : self->light_effects_)
+        show = show || light_effect->show_pending_;
+    }
+    if (show) {
+      self->enable_loop_soon_any_context();
+      App.wake_loop_threadsafe();
+    }
   }
 }
+#endif
 
 void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
   if (std::find(light_effects_.begin(), light_effects_.end(), light_effect) != light_effects_.end()) {
@@ -85,7 +194,10 @@ void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
   ESP_LOGD(TAG, "Registering '%s' for universes %d-%d.", light_effect->get_name(), light_effect->get_first_universe(),
            light_effect->get_last_universe());
 
-  light_effects_.push_back(light_effect);
+  {
+    LockGuard guard(this->lock_);
+    light_effects_.push_back(light_effect);
+  }
 
   for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
     join_(universe);
@@ -101,9 +213,13 @@ void E131Component::remove_effect(E131AddressableLightEffect *light_effect) {
   ESP_LOGD(TAG, "Unregistering '%s' for universes %d-%d.", light_effect->get_name(), light_effect->get_first_universe(),
            light_effect->get_last_universe());
 
-  // Swap with last element and pop for O(1) removal (order doesn't matter)
-  *it = light_effects_.back();
-  light_effects_.pop_back();
+  {
+    // Once the lock is released the receive task no longer writes into this effect's light
+    LockGuard guard(this->lock_);
+    // Swap with last element and pop for O(1) removal (order doesn't matter)
+    *it = light_effects_.back();
+    light_effects_.pop_back();
+  }
 
   for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
     leave_(universe);
@@ -115,6 +231,7 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
 
   ESP_LOGV(TAG, "Received E1.31 packet for %d universe, with %d bytes", universe, packet.count);
 
+  LockGuard guard(this->lock_);
   for (auto *light_effect : light_effects_) {
     handled = light_effect->process_(universe, packet) || handled;
   }
@@ -122,6 +239,19 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
   return handled;
 }
 
+bool E131Component::process_ddp_(const DDPPacket &packet) {
+  bool handled = false;
+
+  ESP_LOGV(TAG, "Received DDP packet at offset %" PRIu32 ", with %u bytes", packet.offset, packet.count);
+
+  LockGuard guard(this->lock_);
+  for (auto *light_effect : light_effects_) {
+    handled = light_effect->process_ddp_(packet) || handled;
+  }
+
+  return handled;
+}
+
 }  // namespace e131
 }  // namespace esphome
 #endif
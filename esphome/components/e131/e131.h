@@ -3,12 +3,18 @@
 #ifdef USE_NETWORK
 #include "esphome/components/socket/socket.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 
 #include <cinttypes>
 #include <map>
 #include <memory>
 #include <vector>
 
+#ifdef USE_E131_TASK
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 namespace e131 {
 
@@ -18,9 +24,18 @@ enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
+/// DMX data of one universe, pointing into the received datagram
 struct E131Packet {
-  uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  uint16_t count;         ///< Number of values, including the start code
+  const uint8_t *values;  ///< Start code followed by the channel values
+};
+
+/// Pixel data of a DDP packet, pointing into the received datagram
+struct DDPPacket {
+  uint32_t offset;        ///< Position of the first byte in the frame
+  uint16_t count;         ///< Number of bytes
+  const uint8_t *values;  ///< The bytes themselves
+  bool push;              ///< Whether the frame is complete with this packet
 };
 
 class E131Component : public esphome::Component {
@@ -36,18 +51,38 @@ class E131Component : public esphome::Component {
   void remove_effect(E131AddressableLightEffect *light_effect);
 
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
+  void set_ddp(bool ddp) { this->ddp_ = ddp; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  std::unique_ptr<socket::Socket> open_socket_(uint16_t port);
+  /// Read and apply every datagram waiting on the sockets.
+  void receive_();
+  /// Show the lights whose effects completed a frame since the last call; main loop only.
+  void show_frames_();
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
+  bool ddp_packet_(const uint8_t *data, size_t len, DDPPacket &packet);
   bool process_(int universe, const E131Packet &packet);
+  bool process_ddp_(const DDPPacket &packet);
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
 
+#ifdef USE_E131_TASK
+  static void receive_task_func(void *param);
+
+  TaskHandle_t receive_task_handle_{nullptr};
+#endif
+
   E131ListenMethod listen_method_{E131_MULTICAST};
+  bool ddp_{false};
   std::unique_ptr<socket::Socket> socket_;
+  std::unique_ptr<socket::Socket> ddp_socket_;
+  /// Guards light_effects_ and the color correction each effect hands to the receive task
+  Mutex lock_;
   std::vector<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
+
+  friend class E131AddressableLightEffect;
 };
 
 }  // namespace e131
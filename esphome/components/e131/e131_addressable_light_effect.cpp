@@ -1,13 +1,16 @@
 #include "e131_addressable_light_effect.h"
 #include "e131.h"
 #ifdef USE_NETWORK
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = E131_MAX_PROPERTY_VALUES_COUNT - 1;
 
 E131AddressableLightEffect::E131AddressableLightEffect(const char *name) : AddressableLightEffect(name) {}
 
@@ -28,6 +31,17 @@ int E131AddressableLightEffect::get_universe_count() const {
 void E131AddressableLightEffect::start() {
   AddressableLightEffect::start();
 
+  // Lights that keep their pixels in one buffer are written directly, others through ESPColorView
+  this->direct_ = this->get_addressable_()->get_pixel_layout(this->layout_);
+  if (this->direct_ && this->lookup_ == nullptr)
+    this->lookup_ = std::unique_ptr<uint8_t[]>(new uint8_t[4 * 256]);
+  this->lookup_local_brightness_ = -1;
+  // Not registered with E131Component yet, so the receive task cannot be using it
+  this->correction_ = this->get_addressable_()->get_correction();
+  this->universes_received_.assign(this->get_universe_count(), false);
+  this->universes_pending_ = this->get_universe_count();
+  this->show_pending_ = false;
+
   if (this->e131_) {
     this->e131_->add_effect(this);
   }
@@ -42,51 +56,186 @@ void E131AddressableLightEffect::stop() {
 }
 
 void E131AddressableLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
-  // ignore, it is run by `E131Component::update()`
+  // Pixels are written by E131Component; this only hands brightness and color correction changes over to it
+  const auto &correction = it.get_correction();
+  if (correction.get_max_brightness().raw_32 == this->correction_.get_max_brightness().raw_32 &&
+      correction.get_local_brightness() == this->correction_.get_local_brightness())
+    return;
+  if (this->e131_ == nullptr) {
+    this->correction_ = correction;
+    return;
+  }
+  LockGuard guard(this->e131_->lock_);
+  this->correction_ = correction;
 }
 
 bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet) {
-  auto *it = get_addressable_();
-
   // check if this is our universe and data are valid
   if (universe < first_universe_ || universe > get_last_universe())
     return false;
 
-  int32_t output_offset = (universe - first_universe_) * get_lights_per_universe();
+  const int index = universe - first_universe_;
+  const int data_per_universe = get_data_per_universe();
+  ESP_LOGV(TAG, "Applying data for '%s' on %d universe.", get_name(), universe);
+
   // limit amount of lights per universe and received
-  int output_end =
-      std::min(it->size(), std::min(output_offset + get_lights_per_universe(), output_offset + packet.count - 1));
-  auto *input_data = packet.values + 1;
+  if (packet.count > 1)
+    this->write_channels_(index * data_per_universe, packet.values + 1,
+                          std::min(data_per_universe, int(packet.count) - 1));
+  this->receive_universe_(index);
+  return true;
+}
+
+bool E131AddressableLightEffect::process_ddp_(const DDPPacket &packet) {
+  this->write_channels_(packet.offset, packet.values, packet.count);
+  if (packet.push)
+    this->show_pending_ = true;
+  return true;
+}
 
-  ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRId32 "-%d.", get_name(), universe, output_offset,
-           output_end);
+void E131AddressableLightEffect::receive_universe_(int index) {
+  const int count = this->universes_received_.size();
+  if (this->universes_received_[index]) {
+    // The sender has moved on to the next frame without sending every universe of this one
+    this->show_pending_ = true;
+    this->universes_received_.assign(count, false);
+    this->universes_pending_ = count;
+  }
+  this->universes_received_[index] = true;
+  if (--this->universes_pending_ == 0) {
+    this->show_pending_ = true;
+    this->universes_received_.assign(count, false);
+    this->universes_pending_ = count;
+  }
+}
+
+void E131AddressableLightEffect::write_channels_(uint32_t channel, const uint8_t *data, size_t len) {
+  const uint32_t channels = this->channels_;
+  const int32_t size = this->get_addressable_()->size();
+  if (channel / channels >= uint32_t(size))
+    return;
+  // A pixel split between two packets is dropped: only one of them carries its start
+  const uint32_t skip = (channels - channel % channels) % channels;
+  if (len <= skip)
+    return;
+  const int32_t pixel = (channel + skip) / channels;
+  const int32_t count = std::min(int32_t((len - skip) / channels), size - pixel);
+  if (count <= 0)
+    return;
+
+  if (this->direct_) {
+    this->write_direct_(pixel, data + skip, count);
+  } else {
+    this->write_views_(pixel, data + skip, count);
+  }
+}
+
+void E131AddressableLightEffect::update_lookup_() {
+  const auto &correction = this->correction_;
+  const uint32_t max_brightness = correction.get_max_brightness().raw_32;
+  const uint8_t local_brightness = correction.get_local_brightness();
+  if (max_brightness == this->lookup_max_brightness_ && local_brightness == this->lookup_local_brightness_)
+    return;
+  this->lookup_max_brightness_ = max_brightness;
+  this->lookup_local_brightness_ = local_brightness;
+
+  uint8_t *lookup = this->lookup_.get();
+  bool identity = true;
+  for (int i = 0; i < 256; i++) {
+    lookup[i] = correction.color_correct_red(i);
+    lookup[256 + i] = correction.color_correct_green(i);
+    lookup[512 + i] = correction.color_correct_blue(i);
+    lookup[768 + i] = correction.color_correct_white(i);
+    identity = identity && lookup[i] == i && lookup[256 + i] == i && lookup[512 + i] == i && lookup[768 + i] == i;
+  }
+
+  // Without gamma, brightness or color correction, packets in the light's own byte order are copied as they are
+  const auto &layout = this->layout_;
+  const bool white_matches = this->channels_ == E131_RGBW ? layout.white == 3 : layout.white < 0;
+  this->copy_ = identity && this->channels_ != E131_MONO && layout.stride == size_t(this->channels_) &&
+                layout.red == 0 && layout.green == 1 && layout.blue == 2 && white_matches;
+}
+
+void HOT E131AddressableLightEffect::write_direct_(int32_t pixel, const uint8_t *data, int32_t count) {
+  this->update_lookup_();
+  uint8_t *output = this->layout_.data + pixel * this->layout_.stride;
+  if (this->copy_) {
+    std::memcpy(output, data, count * this->channels_);
+    return;
+  }
+
+  const uint8_t *red = this->lookup_.get();
+  const uint8_t *green = red + 256;
+  const uint8_t *blue = red + 512;
+  const uint8_t *white = red + 768;
+  const size_t stride = this->layout_.stride;
+  const uint8_t r = this->layout_.red;
+  const uint8_t g = this->layout_.green;
+  const uint8_t b = this->layout_.blue;
+  const int8_t w = this->layout_.white;
 
   switch (channels_) {
     case E131_MONO:
-      for (; output_offset < output_end; output_offset++, input_data++) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[0], input_data[0], input_data[0]));
+      for (int32_t i = 0; i < count; i++, output += stride, data++) {
+        output[r] = red[data[0]];
+        output[g] = green[data[0]];
+        output[b] = blue[data[0]];
+        if (w >= 0)
+          output[w] = white[data[0]];
       }
       break;
 
     case E131_RGB:
-      for (; output_offset < output_end; output_offset++, input_data += 3) {
-        auto output = (*it)[output_offset];
-        output.set(
-            Color(input_data[0], input_data[1], input_data[2], (input_data[0] + input_data[1] + input_data[2]) / 3));
+      for (int32_t i = 0; i < count; i++, output += stride, data += 3) {
+        output[r] = red[data[0]];
+        output[g] = green[data[1]];
+        output[b] = blue[data[2]];
+        if (w >= 0)
+          output[w] = white[(data[0] + data[1] + data[2]) / 3];
       }
       break;
 
     case E131_RGBW:
-      for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[1], input_data[2], input_data[3]));
+      for (int32_t i = 0; i < count; i++, output += stride, data += 4) {
+        output[r] = red[data[0]];
+        output[g] = green[data[1]];
+        output[b] = blue[data[2]];
+        if (w >= 0)
+          output[w] = white[data[3]];
       }
       break;
   }
+}
 
-  it->schedule_show();
-  return true;
+void E131AddressableLightEffect::write_views_(int32_t pixel, const uint8_t *data, int32_t count) {
+  auto *it = get_addressable_();
+  const int32_t end = pixel + count;
+
+  switch (channels_) {
+    case E131_MONO:
+      for (; pixel < end; pixel++, data++) {
+        auto output = (*it)[pixel];
+        output.raw_set_color_correction(&this->correction_);
+        output.set(Color(data[0], data[0], data[0], data[0]));
+      }
+      break;
+
+    case E131_RGB:
+      for (; pixel < end; pixel++, data += 3) {
+        auto output = (*it)[pixel];
+        output.raw_set_color_correction(&this->correction_);
+        output.set(Color(data[0], data[1], data[2], (data[0] + data[1] + data[2]) / 3));
+      }
+      break;
+
+    case E131_RGBW:
+      for (; pixel < end; pixel++, data += 4) {
+        auto output = (*it)[pixel];
+        output.raw_set_color_correction(&this->correction_);
+        output.set(Color(data[0], data[1], data[2], data[3]));
+      }
+      break;
+  }
 }
 
 }  // namespace e131
@@ -3,11 +3,16 @@
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
 #ifdef USE_NETWORK
+#include <atomic>
+#include <memory>
+#include <vector>
+
 namespace esphome {
 namespace e131 {
 
 class E131Component;
 struct E131Packet;
+struct DDPPacket;
 
 enum E131LightChannels { E131_MONO = 1, E131_RGB = 3, E131_RGBW = 4 };
 
@@ -30,13 +35,42 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
   void set_e131(E131Component *e131) { this->e131_ = e131; }
 
  protected:
+  /// Write a universe into the light; returns whether it was one of ours.
   bool process_(int universe, const E131Packet &packet);
+  /// Write DDP data into the light; it uses the same channel layout as the universes.
+  bool process_ddp_(const DDPPacket &packet);
+  /// Write channel values starting at the given channel of the whole light, dropping pixels cut off at either end.
+  void write_channels_(uint32_t channel, const uint8_t *data, size_t len);
+  void write_direct_(int32_t pixel, const uint8_t *data, int32_t count);
+  void write_views_(int32_t pixel, const uint8_t *data, int32_t count);
+  /// Rebuild the color correction lookup when correction_ has changed.
+  void update_lookup_();
+  /// Mark a universe received, requesting a show once every universe of the frame arrived or one arrives twice.
+  void receive_universe_(int index);
 
   int first_universe_{0};
   int last_universe_{0};
   E131LightChannels channels_{E131_RGB};
   E131Component *e131_{nullptr};
 
+  /// Copy of the light's color correction, taken on the main loop. The light changes its own while the receive task
+  /// writes pixels, so the task only uses this one, which is replaced under E131Component::lock_.
+  light::ESPColorCorrection correction_;
+  /// Output buffer of the light, valid if direct_ is set
+  light::ESPPixelLayout layout_{};
+  bool direct_{false};
+  /// The input bytes are the output bytes, so whole universes are copied with memcpy()
+  bool copy_{false};
+  /// Corrected value for each input value, per red, green, blue and white
+  std::unique_ptr<uint8_t[]> lookup_;
+  uint32_t lookup_max_brightness_{0};
+  int16_t lookup_local_brightness_{-1};
+  /// Universes of the current frame that have been received
+  std::vector<bool> universes_received_;
+  int universes_pending_{0};
+  /// Set when a complete frame is in the buffer, cleared when the light has been told to show it
+  std::atomic<bool> show_pending_{false};
+
   friend class E131Component;
 };
 
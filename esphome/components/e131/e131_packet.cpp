@@ -6,10 +6,12 @@
 #include "esphome/core/util.h"
 #include "esphome/core/helpers.h"
 
+#ifndef USE_HOST
 #include <lwip/igmp.h>
 #include <lwip/init.h>
 #include <lwip/ip4_addr.h>
 #include <lwip/ip_addr.h>
+#endif
 
 namespace esphome {
 namespace e131 {
@@ -59,6 +61,16 @@ union E131RawPacket {
 // Get the offset of `property_values[1]`
 const size_t E131_MIN_PACKET_SIZE = reinterpret_cast<size_t>(&((E131RawPacket *) nullptr)->property_values[1]);
 
+#ifdef USE_HOST
+// There is no lwIP on the host, so group membership is set on the socket instead
+static int set_membership(socket::Socket *socket, int universe, int option) {
+  struct ip_mreq imreq = {};
+  imreq.imr_interface.s_addr = ESPHOME_INADDR_ANY;
+  imreq.imr_multiaddr.s_addr = htonl((239u << 24) | (255u << 16) | (universe & 0xffff));
+  return socket->setsockopt(IPPROTO_IP, option, &imreq, sizeof(imreq));
+}
+#endif
+
 bool E131Component::join_igmp_groups_() {
   if (listen_method_ != E131_MULTICAST)
     return false;
@@ -69,6 +81,12 @@ bool E131Component::join_igmp_groups_() {
     if (!universe.second)
       continue;
 
+#ifdef USE_HOST
+    int err = set_membership(this->socket_.get(), universe.first, IP_ADD_MEMBERSHIP);
+    // Every group is joined again whenever one is added; the socket refuses the ones it is already in
+    if (err != 0 && errno == EADDRINUSE)
+      err = 0;
+#else
     ip4_addr_t multicast_addr =
         network::IPAddress(239, 255, ((universe.first >> 8) & 0xff), ((universe.first >> 0) & 0xff));
 
@@ -77,6 +95,7 @@ bool E131Component::join_igmp_groups_() {
       LwIPLock lock;
       err = igmp_joingroup(IP4_ADDR_ANY4, &multicast_addr);
     }
+#endif
 
     if (err) {
       ESP_LOGW(TAG, "IGMP join for %d universe of E1.31 failed. Multicast might not work.", universe.first);
@@ -107,20 +126,25 @@ void E131Component::leave_(int universe) {
   }
 
   if (listen_method_ == E131_MULTICAST) {
+#ifdef USE_HOST
+    if (this->socket_ != nullptr)
+      set_membership(this->socket_.get(), universe, IP_DROP_MEMBERSHIP);
+#else
     ip4_addr_t multicast_addr = network::IPAddress(239, 255, ((universe >> 8) & 0xff), ((universe >> 0) & 0xff));
 
     LwIPLock lock;
     igmp_leavegroup(IP4_ADDR_ANY4, &multicast_addr);
+#endif
   }
 
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -137,8 +161,11 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
   packet.count = htons(sbuff->property_value_count);
   if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
     return false;
+  // The values are used where they were received; a short datagram must not let them run past its end
+  if (E131_MIN_PACKET_SIZE - 1 + packet.count > len)
+    return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  packet.values = sbuff->property_values;
   return true;
 }
 
@@ -33,6 +33,9 @@ class BLEClientBase : public espbt::ESPBTClient, public Component {
 
   void run_later(std::function<void()> &&f);  // NOLINT
 #ifdef USE_ESP32_BLE_DEVICE
+  bool accepts_advertisement(const espbt::ESPBTAdvertisement &advertisement) override {
+    return this->auto_connect_ && this->address_ != 0 && advertisement.address_uint64() == this->address_;
+  }
   bool parse_device(const espbt::ESPBTDevice &device) override;
 #endif
   void on_scan_end() override {}
@@ -12,6 +12,11 @@ class ESPBTAdvertiseTrigger : public Trigger<const ESPBTDevice &>, public ESPBTD
   explicit ESPBTAdvertiseTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
   void set_addresses(std::initializer_list<uint64_t> addresses) { this->address_vec_ = addresses; }
 
+  bool accepts_advertisement(const ESPBTAdvertisement &advertisement) override {
+    return this->address_vec_.empty() || std::find(this->address_vec_.begin(), this->address_vec_.end(),
+                                                   advertisement.address_uint64()) != this->address_vec_.end();
+  }
+
   bool parse_device(const ESPBTDevice &device) override {
     uint64_t u64_addr = device.address_uint64();
     if (!address_vec_.empty()) {
@@ -36,6 +41,12 @@ class BLEServiceDataAdvertiseTrigger : public Trigger<const adv_data_t &>, publi
   void set_service_uuid32(uint32_t uuid) { this->uuid_ = ESPBTUUID::from_uint32(uuid); }
   void set_service_uuid128(uint8_t *uuid) { this->uuid_ = ESPBTUUID::from_raw(uuid); }
 
+  bool accepts_advertisement(const ESPBTAdvertisement &advertisement) override {
+    if (this->address_ && advertisement.address_uint64() != this->address_)
+      return false;
+    return advertisement.has_service_data(this->uuid_);
+  }
+
   bool parse_device(const ESPBTDevice &device) override {
     if (this->address_ && device.address_uint64() != this->address_) {
       return false;
@@ -62,6 +73,12 @@ class BLEManufacturerDataAdvertiseTrigger : public Trigger<const adv_data_t &>,
   void set_manufacturer_uuid32(uint32_t uuid) { this->uuid_ = ESPBTUUID::from_uint32(uuid); }
   void set_manufacturer_uuid128(uint8_t *uuid) { this->uuid_ = ESPBTUUID::from_raw(uuid); }
 
+  bool accepts_advertisement(const ESPBTAdvertisement &advertisement) override {
+    if (this->address_ && advertisement.address_uint64() != this->address_)
+      return false;
+    return advertisement.has_manufacturer_id(this->uuid_);
+  }
+
   bool parse_device(const ESPBTDevice &device) override {
     if (this->address_ && device.address_uint64() != this->address_) {
       return false;
@@ -87,6 +104,7 @@ class BLEEndOfScanTrigger : public Trigger<>, public ESPBTDeviceListener {
   explicit BLEEndOfScanTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
 
 #ifdef USE_ESP32_BLE_DEVICE
+  bool accepts_advertisement(const ESPBTAdvertisement &advertisement) override { return false; }
   bool parse_device(const ESPBTDevice &device) override { return false; }
 #endif
   void on_scan_end() override { this->trigger(); }
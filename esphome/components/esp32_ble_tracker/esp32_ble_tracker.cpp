@@ -17,6 +17,7 @@
 #include <freertos/FreeRTOSConfig.h>
 #include <freertos/task.h>
 #include <nvs_flash.h>
+#include <algorithm>
 #include <cinttypes>
 
 #ifdef USE_OTA
@@ -462,19 +463,11 @@ void ESPBTDevice::parse_scan_rst(const BLEScanResult &scan_result) {
 }
 
 void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
-  size_t offset = 0;
-
-  while (offset + 2 < len) {
-    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
-    if (field_length == 0) {
-      continue;  // Possible zero padded advertisement data
-    }
-
-    // first byte of adv record is adv record type
-    const uint8_t record_type = payload[offset++];
-    const uint8_t *record = &payload[offset];
-    const uint8_t record_length = field_length - 1;
-    offset += record_length;
+  const ESPBTAdvertisement::Iterator end(payload, 0, 0);
+  for (ESPBTAdvertisement::Iterator it(payload, len, 0); it != end; ++it) {
+    const uint8_t record_type = it->type;
+    const uint8_t *record = it->data;
+    const uint8_t record_length = it->length;
 
     // See also Generic Access Profile Assigned Numbers:
     // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
@@ -500,7 +493,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         // CSS 1.5 TX POWER LEVEL
         // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
         // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
+        if (record_length >= 1)
+          this->tx_powers_.push_back(static_cast<int8_t>(*record));
         break;
       }
       case ESP_BLE_AD_TYPE_APPEARANCE: {
@@ -509,7 +503,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         // See also https://www.bluetooth.com/specifications/gatt/characteristics/
         // CSS 1: Optional in this context; shall not appear more than once in a block and shall not appear in both
         // the AD and SRD of the same extended advertising interval.
-        this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
+        if (record_length >= 2)
+          this->appearance_ = encode_uint16(record[1], record[0]);
         break;
       }
       case ESP_BLE_AD_TYPE_FLAG: {
@@ -518,7 +513,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         // Flag bits are non-zero and the advertising packet is connectable, otherwise the Flags data type may be
         // omitted."
         // CSS 1: Optional in this context; shall not appear more than once in a block.
-        this->ad_flag_ = *record;
+        if (record_length >= 1)
+          this->ad_flag_ = *record;
         break;
       }
       // CSS 1.1 SERVICE UUID
@@ -544,7 +540,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
       case ESP_BLE_AD_TYPE_128SRV_CMPL:
       case ESP_BLE_AD_TYPE_128SRV_PART: {
         // • Global 128-bit Service UUIDs
-        this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
+        if (record_length >= 16)
+          this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
         break;
       }
       case ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE: {
@@ -620,6 +617,61 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
   }
 }
 
+bool ESPBTAdvertisement::has_manufacturer_id(const ESPBTUUID &id) const {
+  for (const auto &record : *this) {
+    if (record.type == ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE && record.length >= 2 &&
+        ESPBTUUID::from_uint16(encode_uint16(record.data[1], record.data[0])) == id)
+      return true;
+  }
+  return false;
+}
+
+bool ESPBTAdvertisement::has_service_uuid(const ESPBTUUID &uuid) const {
+  for (const auto &record : *this) {
+    switch (record.type) {
+      case ESP_BLE_AD_TYPE_16SRV_CMPL:
+      case ESP_BLE_AD_TYPE_16SRV_PART:
+        for (uint8_t i = 0; i + 2 <= record.length; i += 2) {
+          if (ESPBTUUID::from_uint16(encode_uint16(record.data[i + 1], record.data[i])) == uuid)
+            return true;
+        }
+        break;
+      case ESP_BLE_AD_TYPE_32SRV_CMPL:
+      case ESP_BLE_AD_TYPE_32SRV_PART:
+        for (uint8_t i = 0; i + 4 <= record.length; i += 4) {
+          if (ESPBTUUID::from_uint32(encode_uint32(record.data[i + 3], record.data[i + 2], record.data[i + 1],
+                                                   record.data[i])) == uuid)
+            return true;
+        }
+        break;
+      case ESP_BLE_AD_TYPE_128SRV_CMPL:
+      case ESP_BLE_AD_TYPE_128SRV_PART:
+        if (record.length >= 16 && ESPBTUUID::from_raw(record.data) == uuid)
+          return true;
+        break;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
+bool ESPBTAdvertisement::has_service_data(const ESPBTUUID &uuid) const {
+  for (const auto &record : *this) {
+    if (record.type == ESP_BLE_AD_TYPE_SERVICE_DATA && record.length >= 2) {
+      if (ESPBTUUID::from_uint16(encode_uint16(record.data[1], record.data[0])) == uuid)
+        return true;
+    } else if (record.type == ESP_BLE_AD_TYPE_32SERVICE_DATA && record.length >= 4) {
+      if (ESPBTUUID::from_uint32(encode_uint32(record.data[3], record.data[2], record.data[1], record.data[0])) == uuid)
+        return true;
+    } else if (record.type == ESP_BLE_AD_TYPE_128SERVICE_DATA && record.length >= 16) {
+      if (ESPBTUUID::from_raw(record.data) == uuid)
+        return true;
+    }
+  }
+  return false;
+}
+
 std::string ESPBTDevice::address_str() const {
   char mac[18];
   format_mac_addr_upper(this->address_, mac);
@@ -627,6 +679,44 @@ std::string ESPBTDevice::address_str() const {
 }
 
 uint64_t ESPBTDevice::address_uint64() const { return esp32_ble::ble_addr_to_uint64(this->address_); }
+
+size_t AddressSet::slot_(uint64_t address) const {
+  // Fibonacci hashing spreads the (often sequential) vendor part of the address over the table
+  return static_cast<size_t>((address * 0x9E3779B97F4A7C15ULL) >> 32) & (this->slots_.size() - 1);
+}
+
+bool AddressSet::insert(uint64_t address) {
+  if ((this->count_ + 1) * 4 > this->slots_.size() * 3)
+    this->grow_();
+  for (size_t i = this->slot_(address);; i = (i + 1) & (this->slots_.size() - 1)) {
+    if (this->slots_[i] == address)
+      return false;
+    if (this->slots_[i] == 0) {
+      this->slots_[i] = address;
+      this->count_++;
+      return true;
+    }
+  }
+}
+
+void AddressSet::clear() {
+  std::fill(this->slots_.begin(), this->slots_.end(), 0);
+  this->count_ = 0;
+}
+
+void AddressSet::grow_() {
+  std::vector<uint64_t> old;
+  old.swap(this->slots_);
+  this->slots_.resize(old.empty() ? 16 : old.size() * 2, 0);
+  for (uint64_t address : old) {
+    if (address == 0)
+      continue;
+    size_t i = this->slot_(address);
+    while (this->slots_[i] != 0)
+      i = (i + 1) & (this->slots_.size() - 1);
+    this->slots_[i] = address;
+  }
+}
 #endif  // USE_ESP32_BLE_DEVICE
 
 void ESP32BLETracker::dump_config() {
@@ -649,12 +739,8 @@ void ESP32BLETracker::dump_config() {
 
 #ifdef USE_ESP32_BLE_DEVICE
 void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
-  const uint64_t address = device.address_uint64();
-  for (auto &disc : this->already_discovered_) {
-    if (disc == address)
-      return;
-  }
-  this->already_discovered_.push_back(address);
+  if (!this->already_discovered_.insert(device.address_uint64()))
+    return;
 
   ESP_LOGD(TAG, "Found device %s RSSI=%d", device.address_str().c_str(), device.get_rssi());
 
@@ -739,27 +825,36 @@ void ESP32BLETracker::process_scan_result_(const BLEScanResult &scan_result) {
   // Process parsed advertisements
   if (this->parse_advertisements_) {
 #ifdef USE_ESP32_BLE_DEVICE
+    // The device is only parsed once some listener accepts the raw advertisement
+    ESPBTAdvertisement advertisement(scan_result);
     ESPBTDevice device;
-    device.parse_scan_rst(scan_result);
+    bool parsed = false;
+    auto parse = [&]() -> const ESPBTDevice & {
+      if (!parsed) {
+        device.parse_scan_rst(scan_result);
+        parsed = true;
+      }
+      return device;
+    };
 
     bool found = false;
 #ifdef ESPHOME_ESP32_BLE_TRACKER_LISTENER_COUNT
     for (auto *listener : this->listeners_) {
-      if (listener->parse_device(device))
+      if (listener->accepts_advertisement(advertisement) && listener->parse_device(parse()))
         found = true;
     }
 #endif
 
 #ifdef ESPHOME_ESP32_BLE_TRACKER_CLIENT_COUNT
     for (auto *client : this->clients_) {
-      if (client->parse_device(device)) {
+      if (client->accepts_advertisement(advertisement) && client->parse_device(parse())) {
         found = true;
       }
     }
 #endif
 
     if (!found && !this->scan_continuous_) {
-      this->print_bt_device_info(device);
+      this->print_bt_device_info(parse());
     }
 #endif  // USE_ESP32_BLE_DEVICE
   }
@@ -41,6 +41,78 @@ struct ServiceData {
 #endif
 
 #ifdef USE_ESP32_BLE_DEVICE
+/// A single AD structure of an advertisement; data points into the scan result and is only valid while it is.
+struct ESPBTAdvRecord {
+  uint8_t type;
+  uint8_t length;
+  const uint8_t *data;
+};
+
+/** Allocation-free view of the advertisement and scan response data of a scan result.
+ *
+ * Iterating yields the AD structures in order; truncated structures at the end of the payload are dropped. This is
+ * used to pre-filter advertisements before the (allocating) ESPBTDevice is built.
+ */
+class ESPBTAdvertisement {
+ public:
+  class Iterator {
+   public:
+    Iterator(const uint8_t *payload, uint8_t len, uint8_t offset) : payload_(payload), len_(len), next_(offset) {
+      this->advance_();
+    }
+    const ESPBTAdvRecord &operator*() const { return this->record_; }
+    const ESPBTAdvRecord *operator->() const { return &this->record_; }
+    Iterator &operator++() {
+      this->advance_();
+      return *this;
+    }
+    bool operator!=(const Iterator &other) const { return this->record_.data != other.record_.data; }
+
+   protected:
+    void advance_() {
+      while (this->next_ < this->len_) {
+        const uint8_t field_length = this->payload_[this->next_++];
+        if (field_length == 0)
+          continue;  // Possible zero padded advertisement data
+        if (field_length > this->len_ - this->next_)
+          break;
+        this->record_ = {this->payload_[this->next_], static_cast<uint8_t>(field_length - 1),
+                         this->payload_ + this->next_ + 1};
+        this->next_ += field_length;
+        return;
+      }
+      this->record_.data = nullptr;
+      this->next_ = this->len_;
+    }
+
+    const uint8_t *payload_;
+    uint8_t len_;
+    uint8_t next_;
+    ESPBTAdvRecord record_{0, 0, nullptr};
+  };
+
+  explicit ESPBTAdvertisement(const BLEScanResult &scan_result) : scan_result_(scan_result) {}
+
+  Iterator begin() const {
+    return {this->scan_result_.ble_adv,
+            static_cast<uint8_t>(this->scan_result_.adv_data_len + this->scan_result_.scan_rsp_len), 0};
+  }
+  Iterator end() const { return {this->scan_result_.ble_adv, 0, 0}; }
+
+  uint64_t address_uint64() const { return esp32_ble::ble_addr_to_uint64(this->scan_result_.bda); }
+  const BLEScanResult &get_scan_result() const { return this->scan_result_; }
+
+  /// Whether a manufacturer specific data record with this company identifier is present.
+  bool has_manufacturer_id(const ESPBTUUID &id) const;
+  /// Whether a service UUID record lists this UUID, as get_service_uuids() would.
+  bool has_service_uuid(const ESPBTUUID &uuid) const;
+  /// Whether a service data record for this UUID is present.
+  bool has_service_data(const ESPBTUUID &uuid) const;
+
+ protected:
+  const BLEScanResult &scan_result_;
+};
+
 class ESPBLEiBeacon {
  public:
   ESPBLEiBeacon() { memset(&this->beacon_data_, 0, sizeof(this->beacon_data_)); }
@@ -118,6 +190,26 @@ class ESPBTDevice {
   std::vector<ServiceData> service_datas_{};
   const BLEScanResult *scan_result_{nullptr};
 };
+
+/** Open-addressing hash set of BLE addresses.
+ *
+ * Uses linear probing in a power-of-two table that doubles when it is three quarters full; 0 marks an empty slot.
+ */
+class AddressSet {
+ public:
+  /// Insert the address, returns false if it was already present.
+  bool insert(uint64_t address);
+  /// Remove all addresses, keeping the table allocated.
+  void clear();
+  size_t size() const { return this->count_; }
+
+ protected:
+  size_t slot_(uint64_t address) const;
+  void grow_();
+
+  std::vector<uint64_t> slots_;
+  size_t count_{0};
+};
 #endif  // USE_ESP32_BLE_DEVICE
 
 class ESP32BLETracker;
@@ -133,6 +225,14 @@ class ESPBTDeviceListener {
     return AdvertisementParserType::PARSED_ADVERTISEMENTS;
   };
   void set_parent(ESP32BLETracker *parent) { parent_ = parent; }
+#ifdef USE_ESP32_BLE_DEVICE
+  /** Cheap check run on the raw advertisement before the ESPBTDevice is parsed.
+   *
+   * Return false if parse_device() would ignore this advertisement (e.g. the address does not match), so that
+   * advertisements nobody is interested in are never parsed.
+   */
+  virtual bool accepts_advertisement(const ESPBTAdvertisement &advertisement) { return true; }
+#endif
 
  protected:
   ESP32BLETracker *parent_{nullptr};
@@ -342,8 +442,8 @@ class ESP32BLETracker : public Component,
 #endif
   std::vector<BLEScannerStateListener *> scanner_state_listeners_;
 #ifdef USE_ESP32_BLE_DEVICE
-  /// Vector of addresses that have already been printed in print_bt_device_info
-  std::vector<uint64_t> already_discovered_;
+  /// Addresses that have already been printed in print_bt_device_info
+  AddressSet already_discovered_;
 #endif
 
   // Group 2: Structs (aligned to 4 bytes)
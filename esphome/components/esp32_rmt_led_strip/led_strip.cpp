@@ -22,6 +22,7 @@ static const uint8_t RMT_CLK_DIV = 2;
 #endif
 
 static const size_t RMT_SYMBOLS_PER_BYTE = 8;
+static const size_t RMT_SYMBOLS_PER_NIBBLE = 4;
 
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
 static size_t IRAM_ATTR HOT encoder_callback(const void *data, size_t size, size_t symbols_written, size_t symbols_free,
@@ -79,14 +80,38 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
-  // copy of the led buffer
-  this->rmt_buf_ = allocator.allocate(buffer_size);
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 3, 0)
+  // without the simple encoder, frames are always encoded on the main loop
+  bool encode_in_loop = true;
 #else
-  RAMAllocator<rmt_symbol_word_t> rmt_allocator(this->use_psram_ ? 0 : RAMAllocator<rmt_symbol_word_t>::ALLOC_INTERNAL);
-
-  // 8 bits per byte, 1 rmt_symbol_word_t per bit + 1 rmt_symbol_word_t for reset
-  this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8 + 1);
+  bool encode_in_loop = this->pre_encode_;
+#endif
+  if (encode_in_loop) {
+    RAMAllocator<rmt_symbol_word_t> rmt_allocator(this->use_psram_ ? 0
+                                                                   : RAMAllocator<rmt_symbol_word_t>::ALLOC_INTERNAL);
+    // 8 bits per byte, 1 rmt_symbol_word_t per bit + 1 rmt_symbol_word_t for reset
+    size_t frame_symbols = buffer_size * RMT_SYMBOLS_PER_BYTE + 1;
+    this->symbol_frames_[0] = rmt_allocator.allocate(frame_symbols);
+    if (this->symbol_frames_[0] == nullptr) {
+      ESP_LOGE(TAG, "Cannot allocate RMT symbol buffer!");
+      this->mark_failed();
+      return;
+    }
+    if (this->pre_encode_) {
+      this->symbol_frames_[1] = rmt_allocator.allocate(frame_symbols);
+      if (this->symbol_frames_[1] == nullptr)
+        ESP_LOGW(TAG, "Cannot allocate second RMT symbol buffer, frames will not be double-buffered");
+    }
+    for (uint8_t nibble = 0; nibble != 16; nibble++) {
+      for (size_t i = 0; i != RMT_SYMBOLS_PER_NIBBLE; i++)
+        this->nibble_symbols_[nibble][i] = (nibble & (0x08 >> i)) ? this->params_.bit1 : this->params_.bit0;
+    }
+  }
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+  else {
+    // copy of the led buffer
+    this->rmt_buf_ = allocator.allocate(buffer_size);
+  }
 #endif
 
   rmt_tx_channel_config_t channel;
@@ -108,25 +133,28 @@ void ESP32RMTLEDStripLightOutput::setup() {
   }
 
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
-  rmt_simple_encoder_config_t encoder;
-  memset(&encoder, 0, sizeof(encoder));
-  encoder.callback = encoder_callback;
-  encoder.arg = &this->params_;
-  encoder.min_chunk_size = RMT_SYMBOLS_PER_BYTE;
-  if (rmt_new_simple_encoder(&encoder, &this->encoder_) != ESP_OK) {
-    ESP_LOGE(TAG, "Encoder creation failed");
-    this->mark_failed();
-    return;
-  }
-#else
-  rmt_copy_encoder_config_t encoder;
-  memset(&encoder, 0, sizeof(encoder));
-  if (rmt_new_copy_encoder(&encoder, &this->encoder_) != ESP_OK) {
-    ESP_LOGE(TAG, "Encoder creation failed");
-    this->mark_failed();
-    return;
-  }
+  if (!encode_in_loop) {
+    rmt_simple_encoder_config_t encoder;
+    memset(&encoder, 0, sizeof(encoder));
+    encoder.callback = encoder_callback;
+    encoder.arg = &this->params_;
+    encoder.min_chunk_size = RMT_SYMBOLS_PER_BYTE;
+    if (rmt_new_simple_encoder(&encoder, &this->encoder_) != ESP_OK) {
+      ESP_LOGE(TAG, "Encoder creation failed");
+      this->mark_failed();
+      return;
+    }
+  } else
 #endif
+  {
+    rmt_copy_encoder_config_t encoder;
+    memset(&encoder, 0, sizeof(encoder));
+    if (rmt_new_copy_encoder(&encoder, &this->encoder_) != ESP_OK) {
+      ESP_LOGE(TAG, "Encoder creation failed");
+      this->mark_failed();
+      return;
+    }
+  }
 
   if (rmt_enable(this->channel_) != ESP_OK) {
     ESP_LOGE(TAG, "Enabling channel failed");
@@ -169,6 +197,12 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
 
   ESP_LOGVV(TAG, "Writing RGB values to bus");
 
+  rmt_symbol_word_t *frame = this->symbol_frames_[this->symbol_frame_];
+  size_t len = 0;
+  // with a second buffer, encode while the previous frame is still being transmitted
+  if (this->symbol_frames_[1] != nullptr)
+    len = this->encode_symbols_(frame);
+
   esp_err_t error = rmt_tx_wait_all_done(this->channel_, 1000);
   if (error != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX timeout");
@@ -177,39 +211,21 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
   }
   delayMicroseconds(50);
 
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
-  memcpy(this->rmt_buf_, this->buf_, this->get_buffer_size_());
-#else
-  size_t buffer_size = this->get_buffer_size_();
-
-  size_t size = 0;
-  size_t len = 0;
-  uint8_t *psrc = this->buf_;
-  rmt_symbol_word_t *pdest = this->rmt_buf_;
-  while (size < buffer_size) {
-    uint8_t b = *psrc;
-    for (int i = 0; i < 8; i++) {
-      pdest->val = b & (1 << (7 - i)) ? this->params_.bit1.val : this->params_.bit0.val;
-      pdest++;
-      len++;
-    }
-    size++;
-    psrc++;
-  }
-
-  if (this->params_.reset.duration0 > 0 || this->params_.reset.duration1 > 0) {
-    pdest->val = this->params_.reset.val;
-    pdest++;
-    len++;
-  }
-#endif
-
   rmt_transmit_config_t config;
   memset(&config, 0, sizeof(config));
+  if (frame != nullptr) {
+    if (this->symbol_frames_[1] == nullptr) {
+      len = this->encode_symbols_(frame);
+    } else {
+      this->symbol_frame_ ^= 1;
+    }
+    error = rmt_transmit(this->channel_, this->encoder_, frame, len * sizeof(rmt_symbol_word_t), &config);
+  }
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
-  error = rmt_transmit(this->channel_, this->encoder_, this->rmt_buf_, this->get_buffer_size_(), &config);
-#else
-  error = rmt_transmit(this->channel_, this->encoder_, this->rmt_buf_, len * sizeof(rmt_symbol_word_t), &config);
+  else {
+    memcpy(this->rmt_buf_, this->buf_, this->get_buffer_size_());
+    error = rmt_transmit(this->channel_, this->encoder_, this->rmt_buf_, this->get_buffer_size_(), &config);
+  }
 #endif
   if (error != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX error");
@@ -219,6 +235,20 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
   this->status_clear_warning();
 }
 
+size_t ESP32RMTLEDStripLightOutput::encode_symbols_(rmt_symbol_word_t *symbols) const {
+  rmt_symbol_word_t *dest = symbols;
+  const uint8_t *src = this->buf_;
+  const uint8_t *end = src + this->get_buffer_size_();
+  for (; src != end; src++) {
+    memcpy(dest, this->nibble_symbols_[*src >> 4], sizeof(this->nibble_symbols_[0]));
+    memcpy(dest + RMT_SYMBOLS_PER_NIBBLE, this->nibble_symbols_[*src & 0x0F], sizeof(this->nibble_symbols_[0]));
+    dest += RMT_SYMBOLS_PER_BYTE;
+  }
+  if (this->params_.reset.duration0 > 0 || this->params_.reset.duration1 > 0)
+    *dest++ = this->params_.reset;
+  return dest - symbols;
+}
+
 light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
   int32_t r = 0, g = 0, b = 0;
   switch (this->rgb_order_) {
@@ -269,7 +299,10 @@ void ESP32RMTLEDStripLightOutput::dump_config() {
                 "ESP32 RMT LED Strip:\n"
                 "  Pin: %u",
                 this->pin_);
-  ESP_LOGCONFIG(TAG, "  RMT Symbols: %" PRIu32, this->rmt_symbols_);
+  ESP_LOGCONFIG(TAG,
+                "  RMT Symbols: %" PRIu32 "\n"
+                "  Pre-encode: %s",
+                this->rmt_symbols_, YESNO(this->symbol_frames_[1] != nullptr));
   const char *rgb_order;
   switch (this->rgb_order_) {
     case ORDER_RGB:
@@ -54,6 +54,9 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   void set_is_wrgb(bool is_wrgb) { this->is_wrgb_ = is_wrgb; }
   void set_use_dma(bool use_dma) { this->use_dma_ = use_dma; }
   void set_use_psram(bool use_psram) { this->use_psram_ = use_psram; }
+  /// Encode frames into RMT symbols on the main loop into two alternating buffers, so the RMT interrupt only copies
+  /// memory and the next frame is encoded while the previous one is still being transmitted.
+  void set_pre_encode(bool pre_encode) { this->pre_encode_ = pre_encode; }
 
   /// Set a maximum refresh rate in µs as some lights do not like being updated too often.
   void set_max_refresh_rate(uint32_t interval_us) { this->max_refresh_rate_ = interval_us; }
@@ -75,6 +78,8 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   light::ESPColorView get_view_internal(int32_t index) const override;
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
+  /// Encode the LED buffer into RMT symbols, returns the number of symbols written.
+  size_t encode_symbols_(rmt_symbol_word_t *symbols) const;
 
   uint8_t *buf_{nullptr};
   uint8_t *effect_data_{nullptr};
@@ -83,9 +88,12 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   rmt_encoder_handle_t encoder_{nullptr};
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
   uint8_t *rmt_buf_{nullptr};
-#else
-  rmt_symbol_word_t *rmt_buf_{nullptr};
 #endif
+  // Symbols for each nibble value, most significant bit first
+  rmt_symbol_word_t nibble_symbols_[16][4];
+  // Pre-encoded frames; the second one is only allocated when pre-encoding is enabled
+  rmt_symbol_word_t *symbol_frames_[2]{nullptr, nullptr};
+  uint8_t symbol_frame_{0};
   uint32_t rmt_symbols_{48};
   uint8_t pin_;
   uint16_t num_leds_;
@@ -93,6 +101,7 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   bool is_wrgb_{false};
   bool use_dma_{false};
   bool use_psram_{false};
+  bool pre_encode_{false};
 
   RGBOrder rgb_order_{ORDER_RGB};
 
@@ -440,6 +440,7 @@ DEFAULT_GLYPHS = (
 )
 
 CONF_RAW_GLYPH_ID = "raw_glyph_id"
+CONF_GLYPH_CACHE_SIZE = "glyph_cache_size"
 
 FONT_SCHEMA = cv.Schema(
     {
@@ -452,6 +453,7 @@ FONT_SCHEMA = cv.Schema(
         cv.Optional(CONF_IGNORE_MISSING_GLYPHS, default=False): cv.boolean,
         cv.Optional(CONF_SIZE): cv.int_range(min=1),
         cv.Optional(CONF_BPP, default=1): cv.one_of(1, 2, 4, 8),
+        cv.Optional(CONF_GLYPH_CACHE_SIZE): cv.int_range(min=1, max=1024),
         cv.Optional(CONF_EXTRAS, default=[]): cv.ensure_list(
             cv.Schema(
                 {
@@ -612,7 +614,7 @@ async def to_code(config):
             ascender = font_height
         else:
             _LOGGER.error("Unable to determine height of font %s", config[CONF_FILE])
-    cg.new_Pvariable(
+    var = cg.new_Pvariable(
         config[CONF_ID],
         glyphs,
         len(glyph_initializer),
@@ -623,3 +625,6 @@ async def to_code(config):
         capheight,
         bpp,
     )
+    if glyph_cache_size := config.get(CONF_GLYPH_CACHE_SIZE):
+        cg.add_define("USE_FONT_GLYPH_CACHE")
+        cg.add(var.set_glyph_cache_size(glyph_cache_size))
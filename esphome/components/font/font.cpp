@@ -1,12 +1,46 @@
 #include "font.h"
 
+#include <algorithm>
+
 #include "esphome/core/color.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
 namespace font {
 static const char *const TAG = "font";
+#ifdef USE_DISPLAY
+// Glyph rows are decoded into a coverage mask of up to this many pixels and drawn with one blend_run() call each
+static constexpr int GLYPH_RUN_LENGTH = 32;
+#endif
+
+/// Sequential reader for the packed glyph bitmaps; the bit stream continues across rows.
+struct GlyphBitReader {
+  const uint8_t *data;
+  uint8_t bpp;
+  uint8_t bitmask{0};
+  uint8_t pixel_data{0};
+
+  /// Decode count pixels into coverage values scaled to 0..255.
+  void read(uint8_t *alpha, int count) {
+    const uint8_t bpp_max = (1 << this->bpp) - 1;
+    for (int i = 0; i != count; i++) {
+      uint8_t pixel = 0;
+      for (uint8_t bit_num = 0; bit_num != this->bpp; bit_num++) {
+        if (this->bitmask == 0) {
+          this->pixel_data = progmem_read_byte(this->data++);
+          this->bitmask = 0x80;
+        }
+        pixel <<= 1;
+        if ((this->pixel_data & this->bitmask) != 0)
+          pixel |= 1;
+        this->bitmask >>= 1;
+      }
+      alpha[i] = pixel == bpp_max ? 255 : pixel * 255 / bpp_max;
+    }
+  }
+};
 
 #ifdef USE_LVGL_FONT
 const uint8_t *Font::get_glyph_bitmap(const lv_font_t *font, uint32_t unicode_letter) {
@@ -159,6 +193,9 @@ Font::Font(const Glyph *data, int data_nr, int baseline, int height, int descend
       xheight_(xheight),
       capheight_(capheight),
       bpp_(bpp) {
+  std::fill(std::begin(this->ascii_index_), std::end(this->ascii_index_), ASCII_MISSING);
+  for (int i = 0; i != data_nr && data[i].code_point < 128; i++)
+    this->ascii_index_[data[i].code_point] = i;
 #ifdef USE_LVGL_FONT
   this->lv_font_.dsc = this;
   this->lv_font_.line_height = this->get_height();
@@ -172,6 +209,10 @@ Font::Font(const Glyph *data, int data_nr, int baseline, int height, int descend
 }
 
 const Glyph *Font::find_glyph(uint32_t codepoint) const {
+  if (codepoint < 128) {
+    uint8_t index = this->ascii_index_[codepoint];
+    return index == ASCII_MISSING ? nullptr : &this->glyphs_[index];
+  }
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -242,47 +283,89 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
       continue;
     }
 
-    const uint8_t *data = glyph->data;
-    const int max_x = x_at + glyph->offset_x + glyph->width;
-    const int max_y = y_start + glyph->offset_y + glyph->height;
-
-    uint8_t bitmask = 0;
-    uint8_t pixel_data = 0;
-    uint8_t bpp_max = (1 << this->bpp_) - 1;
-    auto diff_r = (float) color.r - (float) background.r;
-    auto diff_g = (float) color.g - (float) background.g;
-    auto diff_b = (float) color.b - (float) background.b;
-    auto diff_w = (float) color.w - (float) background.w;
-    auto b_r = (float) background.r;
-    auto b_g = (float) background.g;
-    auto b_b = (float) background.b;
-    auto b_w = (float) background.w;
-    for (int glyph_y = y_start + glyph->offset_y; glyph_y != max_y; glyph_y++) {
-      for (int glyph_x = x_at + glyph->offset_x; glyph_x != max_x; glyph_x++) {
-        uint8_t pixel = 0;
-        for (uint8_t bit_num = 0; bit_num != this->bpp_; bit_num++) {
-          if (bitmask == 0) {
-            pixel_data = progmem_read_byte(data++);
-            bitmask = 0x80;
-          }
-          pixel <<= 1;
-          if ((pixel_data & bitmask) != 0)
-            pixel |= 1;
-          bitmask >>= 1;
-        }
-        if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
-          auto on = (float) pixel / (float) bpp_max;
-          auto blended = Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g),
-                               (uint8_t) (diff_b * on + b_b), (uint8_t) (diff_w * on + b_w));
-          display->draw_pixel_at(glyph_x, glyph_y, blended);
-        }
+    const int min_x = x_at + glyph->offset_x;
+    const int min_y = y_start + glyph->offset_y;
+
+#ifdef USE_FONT_GLYPH_CACHE
+    const uint8_t *mask = this->get_glyph_mask_(glyph);
+    if (mask != nullptr) {
+      for (int row = 0; row != glyph->height; row++, mask += glyph->width)
+        display->blend_run(min_x, min_y + row, glyph->width, mask, color, background);
+      x_at += glyph->advance;
+      continue;
+    }
+#endif
+
+    GlyphBitReader reader{glyph->data, this->bpp_};
+    uint8_t alpha[GLYPH_RUN_LENGTH];
+    for (int row = 0; row != glyph->height; row++) {
+      for (int run_x = 0; run_x < glyph->width; run_x += GLYPH_RUN_LENGTH) {
+        const int run_width = std::min(glyph->width - run_x, GLYPH_RUN_LENGTH);
+        // The display blends partial coverage against the background
+        reader.read(alpha, run_width);
+        display->blend_run(min_x + run_x, min_y + row, run_width, alpha, color, background);
       }
     }
     x_at += glyph->advance;
   }
 }
 #endif
+
+#ifdef USE_FONT_GLYPH_CACHE
+const uint8_t *Font::get_glyph_mask_(const Glyph *glyph) {
+  if (this->glyph_cache_size_ == 0)
+    return nullptr;
+  const size_t size = glyph->width * glyph->height;
+  if (size == 0)
+    return nullptr;
+  if (this->glyph_slots_.empty())
+    this->glyph_slots_.resize(this->glyphs_.size(), 0);
+  const size_t index = glyph - &this->glyphs_[0];
+  this->glyph_cache_clock_++;
+
+  uint16_t slot = this->glyph_slots_[index];
+  if (slot != 0) {
+    auto &entry = this->glyph_cache_[slot - 1];
+    entry.last_used = this->glyph_cache_clock_;
+    return entry.mask;
+  }
+
+  // Miss: take a free slot while the cache is filling up, afterwards evict the least recently used glyph
+  if (this->glyph_cache_.size() < this->glyph_cache_size_) {
+    this->glyph_cache_.push_back({nullptr, nullptr, 0, 0});
+    slot = this->glyph_cache_.size();
+  } else {
+    slot = 1;
+    for (size_t i = 1; i < this->glyph_cache_.size(); i++) {
+      if (this->glyph_cache_[i].last_used < this->glyph_cache_[slot - 1].last_used)
+        slot = i + 1;
+    }
+  }
+  auto &entry = this->glyph_cache_[slot - 1];
+  if (entry.glyph != nullptr)
+    this->glyph_slots_[entry.glyph - &this->glyphs_[0]] = 0;
+  entry.glyph = nullptr;
+
+  if (entry.capacity < size) {
+    RAMAllocator<uint8_t> allocator;
+    if (entry.mask != nullptr)
+      allocator.deallocate(entry.mask, entry.capacity);
+    entry.capacity = 0;
+    entry.mask = allocator.allocate(size);
+    if (entry.mask == nullptr) {
+      ESP_LOGW(TAG, "Could not allocate %zu bytes for glyph cache", size);
+      return nullptr;
+    }
+    entry.capacity = size;
+  }
+
+  GlyphBitReader reader{glyph->data, this->bpp_};
+  reader.read(entry.mask, size);
+  entry.glyph = glyph;
+  entry.last_used = this->glyph_cache_clock_;
+  this->glyph_slots_[index] = slot;
+  return entry.mask;
+}
+#endif
 }  // namespace font
 }  // namespace esphome
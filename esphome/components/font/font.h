@@ -3,6 +3,9 @@
 #include "esphome/core/color.h"
 #include "esphome/core/datatypes.h"
 #include "esphome/core/defines.h"
+#ifdef USE_FONT_GLYPH_CACHE
+#include <vector>
+#endif
 #ifdef USE_DISPLAY
 #include "esphome/components/display/display.h"
 #endif
@@ -60,6 +63,11 @@ class Font
 
   const Glyph *find_glyph(uint32_t codepoint) const;
 
+#ifdef USE_FONT_GLYPH_CACHE
+  /// Set the number of decoded glyph coverage masks kept in memory (PSRAM when available).
+  void set_glyph_cache_size(uint16_t size) { this->glyph_cache_size_ = size; }
+#endif
+
 #ifdef USE_DISPLAY
   void print(int x_start, int y_start, display::Display *display, Color color, const char *text,
              Color background) override;
@@ -88,6 +96,24 @@ class Font
   int xheight_;
   int capheight_;
   uint8_t bpp_;  // bits per pixel
+  /// Index into glyphs_ for each ASCII codepoint, or ASCII_MISSING; glyphs are sorted so these all fit below 128.
+  static constexpr uint8_t ASCII_MISSING = 0xFF;
+  uint8_t ascii_index_[128];
+#ifdef USE_FONT_GLYPH_CACHE
+  struct GlyphCacheEntry {
+    const Glyph *glyph;
+    uint8_t *mask;
+    size_t capacity;
+    uint32_t last_used;
+  };
+  /// Return the decoded 0..255 coverage mask of the glyph (width * height bytes), or nullptr if it can't be cached.
+  const uint8_t *get_glyph_mask_(const Glyph *glyph);
+  std::vector<GlyphCacheEntry> glyph_cache_;
+  /// Cache slot + 1 for each glyph, 0 if the glyph is not cached.
+  std::vector<uint16_t> glyph_slots_;
+  uint32_t glyph_cache_clock_{0};
+  uint16_t glyph_cache_size_{0};
+#endif
 #ifdef USE_LVGL_FONT
   lv_font_t lv_font_{};
   static const uint8_t *get_glyph_bitmap(const lv_font_t *font, uint32_t unicode_letter);
@@ -50,6 +50,8 @@ import esphome.final_validate as fv
 
 LOGGER = logging.getLogger(__name__)
 CODEOWNERS = ["@esphome/core"]
+
+
 i2c_ns = cg.esphome_ns.namespace("i2c")
 I2CBus = i2c_ns.class_("I2CBus")
 InternalI2CBus = i2c_ns.class_("InternalI2CBus", I2CBus)
@@ -80,6 +82,7 @@ LP_I2C_VARIANT = list(VALIDATE_LP_I2C.keys())
 
 CONF_SDA_PULLUP_ENABLED = "sda_pullup_enabled"
 CONF_SCL_PULLUP_ENABLED = "scl_pullup_enabled"
+KEY_I2C_ASYNC = "i2c_async"
 MULTI_CONF = True
 
 
@@ -228,6 +231,36 @@ async def to_code(config):
         cg.add(var.set_lp_mode(bool(config[CONF_LOW_POWER_MODE])))
 
 
+def async_transactions_auto_load() -> list[str]:
+    """AUTO_LOAD entries for components that call request_async_transactions().
+
+    On ESP32 the transaction task wakes the main loop through socket. AUTO_LOAD is examined
+    before code generation, so these components load it themselves instead of every bus.
+    """
+    if CORE.is_esp32:
+        return ["socket"]
+    return []
+
+
+def request_async_transactions() -> None:
+    """Request that I2CBus::submit() runs transactions in the background.
+
+    Components that submit I2CTransaction chains should call this function during
+    their code generation. On ESP32 it enables the bus transaction task, which
+    delivers completions to the main loop; elsewhere transactions keep running
+    synchronously inside submit().
+    """
+    if CORE.data.get(KEY_I2C_ASYNC, False):
+        return
+    CORE.data[KEY_I2C_ASYNC] = True
+    if CORE.is_esp32:
+        cg.add_define("USE_I2C_ASYNC")
+        # The transaction task uses wake_loop_threadsafe() to hand completions to the main loop
+        from esphome.components import socket
+
+        socket.require_wake_loop_threadsafe()
+
+
 def i2c_device_schema(default_address):
     """Create a schema for a i2c device.
 
@@ -32,6 +32,61 @@ void I2CBus::i2c_scan_() {
 #endif
 }
 
+I2CTransaction &I2CTransaction::write_read(const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                                           size_t read_count) {
+  Step &step = this->steps_.emplace_back();
+  step.write_buffer = write_buffer;
+  step.write_count = write_count;
+  step.read_buffer = read_buffer;
+  step.read_count = read_count;
+  return *this;
+}
+
+I2CTransaction &I2CTransaction::write_register(uint8_t a_register, const uint8_t *data, size_t len) {
+  if (len >= INLINE_WRITE_SIZE) {
+    this->too_large_ = true;
+    return *this;
+  }
+  Step &step = this->steps_.emplace_back();
+  step.write_buffer = nullptr;
+  step.write_count = len + 1;
+  step.read_buffer = nullptr;
+  step.read_count = 0;
+  step.inline_write[0] = a_register;
+  std::copy(data, data + len, step.inline_write + 1);
+  return *this;
+}
+
+I2CTransaction &I2CTransaction::read_register(uint8_t a_register, uint8_t *data, size_t len) {
+  Step &step = this->steps_.emplace_back();
+  step.write_buffer = nullptr;
+  step.write_count = 1;
+  step.read_buffer = data;
+  step.read_count = len;
+  step.inline_write[0] = a_register;
+  return *this;
+}
+
+ErrorCode I2CBus::submit(uint8_t address, I2CTransaction *transaction, I2CTransaction::Callback &&callback) {
+  if (transaction->pending_)
+    return ERROR_INVALID_ARGUMENT;
+  if (transaction->too_large_)
+    return ERROR_TOO_LARGE;
+  transaction->address_ = address;
+  callback(this->run_transaction_(address, *transaction));
+  return ERROR_OK;
+}
+
+ErrorCode I2CBus::run_transaction_(uint8_t address, const I2CTransaction &transaction) {
+  for (const auto &step : transaction.steps_) {
+    const uint8_t *write_buffer = step.write_buffer != nullptr ? step.write_buffer : step.inline_write;
+    ErrorCode err = this->write_readv(address, write_buffer, step.write_count, step.read_buffer, step.read_count);
+    if (err != ERROR_OK)
+      return err;
+  }
+  return ERROR_OK;
+}
+
 ErrorCode I2CDevice::read_register(uint8_t a_register, uint8_t *data, size_t len) {
   return bus_->write_readv(this->address_, &a_register, 1, data, len);
 }
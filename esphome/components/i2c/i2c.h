@@ -209,6 +209,14 @@ class I2CDevice {
   /// @return an i2c::ErrorCode
   ErrorCode write_register16(uint16_t a_register, const uint8_t *data, size_t len) const;
 
+  /// @brief queues a transaction to the I²C device without waiting for the bus
+  /// @param transaction the transfers to run; it must not be modified until the callback has run
+  /// @param callback called from the main loop with the result of the transaction
+  /// @return an i2c::ErrorCode; the callback is only called if this is ERROR_OK
+  ErrorCode submit(I2CTransaction *transaction, I2CTransaction::Callback &&callback) {
+    return bus_->submit(this->address_, transaction, std::move(callback));
+  }
+
   ///
   /// Compat APIs
   /// All methods below have been added for compatibility reasons. They do not bring any functionality and therefore on
@@ -2,6 +2,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -38,6 +39,7 @@ enum ErrorCode {
   ERROR_TOO_LARGE = 5,         ///< requested a transfer larger than buffers can hold
   ERROR_UNKNOWN = 6,           ///< miscellaneous I2C error during execution
   ERROR_CRC = 7,               ///< bytes received with a CRC error
+  ERROR_BUSY = 8,              ///< too many transactions already submitted, try again later
 };
 
 /// @brief the ReadBuffer structure stores a pointer to a read buffer and its length
@@ -52,6 +54,57 @@ struct WriteBuffer {
   size_t len;           ///< length of the buffer
 };
 
+/// @brief A chain of transfers to one device that is run by I2CBus::submit() without blocking the main loop.
+/// @details Each transfer is a write followed by a read after a repeated start; either part may be empty. The
+/// transfers run back to back in the order they were added and the chain stops at the first one that fails. Buffers
+/// passed by pointer are not copied and must stay valid until the completion callback has run. A transaction is
+/// meant to be kept by its component and reused: clear() keeps the storage allocated.
+class I2CTransaction {
+ public:
+  using Callback = std::function<void(ErrorCode)>;
+  /// Bytes a single write_register() step can carry in the transaction itself, including the register address
+  static constexpr size_t INLINE_WRITE_SIZE = 4;
+
+  /// @brief Append a write of write_count bytes followed by a read of read_count bytes.
+  I2CTransaction &write_read(const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                             size_t read_count);
+  /// @brief Append a write of len bytes.
+  I2CTransaction &write(const uint8_t *data, size_t len) { return this->write_read(data, len, nullptr, 0); }
+  /// @brief Append a read of len bytes.
+  I2CTransaction &read(uint8_t *data, size_t len) { return this->write_read(nullptr, 0, data, len); }
+  /// @brief Append a write of a register address and up to INLINE_WRITE_SIZE - 1 data bytes, which are copied.
+  I2CTransaction &write_register(uint8_t a_register, const uint8_t *data, size_t len);
+  /// @brief Append a write of a register address followed by a read of len bytes from it.
+  I2CTransaction &read_register(uint8_t a_register, uint8_t *data, size_t len);
+
+  /// @brief Remove all transfers so the transaction can be filled again.
+  void clear() {
+    this->steps_.clear();
+    this->too_large_ = false;
+  }
+  /// @brief Whether the transaction has been submitted and its callback has not run yet.
+  bool is_pending() const { return this->pending_; }
+
+ protected:
+  friend class I2CBus;
+  friend class IDFI2CBus;
+
+  struct Step {
+    const uint8_t *write_buffer;  ///< nullptr if the bytes are stored in inline_write
+    size_t write_count;
+    uint8_t *read_buffer;
+    size_t read_count;
+    uint8_t inline_write[INLINE_WRITE_SIZE];
+  };
+
+  std::vector<Step> steps_;
+  Callback callback_;
+  uint8_t address_{0};
+  ErrorCode result_{ERROR_OK};
+  bool pending_{false};
+  bool too_large_{false};
+};
+
 /// @brief This Class provides the methods to read and write bytes from an I2CBus.
 /// @note The I2CBus virtual class follows a *Factory design pattern* that provides all the interfaces methods required
 /// by clients while deferring the actual implementation of these methods to a subclasses. I2C-bus specification and
@@ -74,6 +127,15 @@ class I2CBus {
   virtual ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
                                 size_t read_count) = 0;
 
+  /// @brief Queue a transaction to the device at address and return without waiting for the bus.
+  /// @param address address of the I²C device on the i2c bus
+  /// @param transaction the transfers to run; it must not be modified until the callback has run
+  /// @param callback called from the main loop with the result once the transaction completed or failed
+  /// @return ERROR_OK if the transaction was accepted, in which case the callback will be called exactly once;
+  /// otherwise the callback is not called. ERROR_BUSY means too many transactions are in flight on this bus.
+  /// @details Buses without a transaction task run the transaction before returning and call the callback directly.
+  virtual ErrorCode submit(uint8_t address, I2CTransaction *transaction, I2CTransaction::Callback &&callback);
+
   // Legacy functions for compatibility
 
   ErrorCode read(uint8_t address, uint8_t *buffer, size_t len) {
@@ -129,6 +191,9 @@ class I2CBus {
   }
 
  protected:
+  /// @brief Run the transfers of a transaction one after the other, stopping at the first error.
+  ErrorCode run_transaction_(uint8_t address, const I2CTransaction &transaction);
+
   /// @brief Scans the I2C bus for devices. Devices presence is kept in an array of std::pair
   /// that contains the address and the corresponding bool presence flag.
   void i2c_scan_();
@@ -79,6 +79,10 @@ void IDFI2CBus::setup() {
   }
 
   this->initialized_ = true;
+#ifdef USE_I2C_ASYNC
+  // loop() only has work while transactions are in flight
+  this->disable_loop();
+#endif
 
   if (this->scan_) {
     ESP_LOGV(TAG, "Scanning for devices");
@@ -193,6 +197,77 @@ ErrorCode IDFI2CBus::write_readv(uint8_t address, const uint8_t *write_buffer, s
   return ERROR_OK;
 }
 
+#ifdef USE_I2C_ASYNC
+ErrorCode IDFI2CBus::submit(uint8_t address, I2CTransaction *transaction, I2CTransaction::Callback &&callback) {
+  if (!this->initialized_)
+    return ERROR_NOT_INITIALIZED;
+  if (transaction->pending_)
+    return ERROR_INVALID_ARGUMENT;
+  if (transaction->too_large_)
+    return ERROR_TOO_LARGE;
+  if (this->transaction_task_handle_ == nullptr && !this->start_transaction_task_())
+    return I2CBus::submit(address, transaction, std::move(callback));
+  // Running it here instead would call back before the transactions queued ahead of it
+  if (this->in_flight_ == MAX_IN_FLIGHT)
+    return ERROR_BUSY;
+
+  transaction->address_ = address;
+  transaction->callback_ = std::move(callback);
+  transaction->pending_ = true;
+  this->in_flight_++;
+  this->enable_loop();
+  xQueueSend(this->pending_queue_, &transaction, 0);
+  return ERROR_OK;
+}
+
+void IDFI2CBus::loop() {
+  I2CTransaction *transaction;
+  while ((transaction = this->done_queue_.pop()) != nullptr) {
+    this->in_flight_--;
+    transaction->pending_ = false;
+    // The callback may submit the transaction again, which replaces callback_
+    auto callback = std::move(transaction->callback_);
+    callback(transaction->result_);
+  }
+  if (this->in_flight_ == 0)
+    this->disable_loop();
+}
+
+bool IDFI2CBus::start_transaction_task_() {
+  this->pending_queue_ = xQueueCreate(MAX_IN_FLIGHT, sizeof(I2CTransaction *));
+  if (this->pending_queue_ == nullptr)
+    return false;
+  // Just above the main loop, so a transfer that has finished is followed by the next one without waiting for it
+  BaseType_t result = xTaskCreate(transaction_task_func, "i2c_txn", 2560, this, tskIDLE_PRIORITY + 2,
+                                  &this->transaction_task_handle_);
+  if (result != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create transaction task");
+    vQueueDelete(this->pending_queue_);
+    this->pending_queue_ = nullptr;
+    this->transaction_task_handle_ = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void IDFI2CBus::transaction_task_func(void *param) {
+  auto *self = static_cast<IDFI2CBus *>(param);
+  I2CTransaction *transaction;
+
+  // Run forever - task lifecycle matches component lifecycle
+  while (true) {
+    if (xQueueReceive(self->pending_queue_, &transaction, portMAX_DELAY) != pdTRUE)
+      continue;
+    // The driver takes the bus lock for each transfer, so synchronous transfers from the main loop can run in between
+    transaction->result_ = self->run_transaction_(transaction->address_, *transaction);
+    // Cannot fail: in_flight_ limits the transactions to the queue's capacity
+    self->done_queue_.push(transaction);
+    self->enable_loop_soon_any_context();
+    App.wake_loop_threadsafe();
+  }
+}
+#endif  // USE_I2C_ASYNC
+
 /// Perform I2C bus recovery, see:
 /// https://www.nxp.com/docs/en/user-guide/UM10204.pdf
 /// https://www.analog.com/media/en/technical-documentation/application-notes/54305147357414AN686_0.pdf
@@ -6,6 +6,13 @@
 #include "i2c_bus.h"
 #include <driver/i2c_master.h>
 
+#ifdef USE_I2C_ASYNC
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include "esphome/core/lock_free_queue.h"
+#endif
+
 namespace esphome {
 namespace i2c {
 
@@ -22,6 +29,10 @@ class IDFI2CBus : public InternalI2CBus, public Component {
   ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
                         size_t read_count) override;
   float get_setup_priority() const override { return setup_priority::BUS; }
+#ifdef USE_I2C_ASYNC
+  ErrorCode submit(uint8_t address, I2CTransaction *transaction, I2CTransaction::Callback &&callback) override;
+  void loop() override;
+#endif
 
   void set_scan(bool scan) { this->scan_ = scan; }
   void set_sda_pin(uint8_t sda_pin) { this->sda_pin_ = sda_pin; }
@@ -54,6 +65,20 @@ class IDFI2CBus : public InternalI2CBus, public Component {
 #if SOC_LP_I2C_SUPPORTED
   bool lp_mode_ = false;
 #endif
+#ifdef USE_I2C_ASYNC
+  /// Transactions that may be queued or running at once
+  static constexpr uint8_t MAX_IN_FLIGHT = 8;
+
+  bool start_transaction_task_();
+  static void transaction_task_func(void *param);
+
+  TaskHandle_t transaction_task_handle_{nullptr};
+  /// Submitted transactions, consumed by the transaction task
+  QueueHandle_t pending_queue_{nullptr};
+  /// Finished transactions, pushed by the transaction task and completed in loop()
+  LockFreeQueue<I2CTransaction, MAX_IN_FLIGHT + 1> done_queue_;
+  uint8_t in_flight_{0};
+#endif
 };
 
 }  // namespace i2c
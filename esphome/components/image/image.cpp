@@ -1,11 +1,16 @@
 #include "image.h"
 
+#include <algorithm>
+
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
 namespace image {
 
+// Grayscale rows with an alpha channel are converted into a coverage mask of up to this many pixels per blend_run()
+static constexpr int IMAGE_RUN_LENGTH = 32;
+
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
   int img_x0 = 0;
   int img_y0 = 0;
@@ -26,47 +31,68 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
 
   switch (type_) {
     case IMAGE_TYPE_BINARY: {
-      for (int img_x = img_x0; img_x < w; img_x++) {
-        for (int img_y = img_y0; img_y < h; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
+      // Draw each row as runs of equal pixels
+      for (int img_y = img_y0; img_y < h; img_y++) {
+        int run_start = img_x0;
+        while (run_start < w) {
+          const bool on = this->get_binary_pixel_(run_start, img_y);
+          int run_end = run_start + 1;
+          while (run_end < w && this->get_binary_pixel_(run_end, img_y) == on)
+            run_end++;
+          if (on) {
+            display->fill_run(x + run_start, y + img_y, run_end - run_start, color_on);
           } else if (!this->transparency_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
+            display->fill_run(x + run_start, y + img_y, run_end - run_start, color_off);
           }
+          run_start = run_end;
         }
       }
       break;
     }
     case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = img_x0; img_x < w; img_x++) {
+      if (this->transparency_ == TRANSPARENCY_ALPHA_CHANNEL) {
+        // The gray value is the coverage of color_on over color_off
+        const Color on(color_on.r, color_on.g, color_on.b, 0xFF);
+        const Color off(color_off.r, color_off.g, color_off.b, 0xFF);
+        uint8_t alpha[IMAGE_RUN_LENGTH];
         for (int img_y = img_y0; img_y < h; img_y++) {
-          const uint32_t pos = (img_x + img_y * this->width_);
-          const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
-          Color color = Color(gray, gray, gray, 0xFF);
-          switch (this->transparency_) {
-            case TRANSPARENCY_CHROMA_KEY:
-              if (gray == 1) {
-                continue;  // skip drawing
+          for (int run_x = img_x0; run_x < w; run_x += IMAGE_RUN_LENGTH) {
+            const int run_width = std::min(w - run_x, IMAGE_RUN_LENGTH);
+            const uint8_t *src = this->data_start_ + run_x + img_y * this->width_;
+            for (int i = 0; i != run_width; i++)
+              alpha[i] = progmem_read_byte(src + i);
+            // Zero coverage leaves a pixel untouched in blend_run(), so those stretches are filled with color_off
+            // instead; every pixel is written once
+            int start = 0;
+            while (start != run_width) {
+              const bool covered = alpha[start] != 0;
+              int end = start + 1;
+              while (end != run_width && (alpha[end] != 0) == covered)
+                end++;
+              if (covered) {
+                display->blend_run(x + run_x + start, y + img_y, end - start, alpha + start, on, off);
+              } else {
+                display->fill_run(x + run_x + start, y + img_y, end - start, off);
               }
-              break;
-            case TRANSPARENCY_ALPHA_CHANNEL: {
-              auto on = (float) gray / 255.0f;
-              auto off = 1.0f - on;
-              // blend color_on and color_off
-              color = Color(color_on.r * on + color_off.r * off, color_on.g * on + color_off.g * off,
-                            color_on.b * on + color_off.b * off, 0xFF);
-              break;
+              start = end;
             }
-            default:
-              break;
           }
-          display->draw_pixel_at(x + img_x, y + img_y, color);
+        }
+        break;
+      }
+      for (int img_y = img_y0; img_y < h; img_y++) {
+        for (int img_x = img_x0; img_x < w; img_x++) {
+          const uint32_t pos = (img_x + img_y * this->width_);
+          const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
+          if (this->transparency_ == TRANSPARENCY_CHROMA_KEY && gray == 1)
+            continue;  // skip drawing
+          display->draw_pixel_at(x + img_x, y + img_y, Color(gray, gray, gray, 0xFF));
         }
       }
       break;
     case IMAGE_TYPE_RGB565:
-      for (int img_x = img_x0; img_x < w; img_x++) {
-        for (int img_y = img_y0; img_y < h; img_y++) {
+      for (int img_y = img_y0; img_y < h; img_y++) {
+        for (int img_x = img_x0; img_x < w; img_x++) {
           auto color = this->get_rgb565_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -75,8 +101,8 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB:
-      for (int img_x = img_x0; img_x < w; img_x++) {
-        for (int img_y = img_y0; img_y < h; img_y++) {
+      for (int img_y = img_y0; img_y < h; img_y++) {
+        for (int img_x = img_x0; img_x < w; img_x++) {
           auto color = this->get_rgb_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -0,0 +1,209 @@
+#include "json_writer.h"
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace json {
+
+static const char *const HEX_DIGITS = "0123456789abcdef";
+
+JsonWriter::JsonWriter(char *buffer, size_t size) : buffer_(buffer), capacity_(size) {
+  if (this->capacity_ == 0) {
+    this->overflowed_ = true;
+    return;
+  }
+  this->buffer_[0] = '\0';
+}
+
+void JsonWriter::write_(char c) {
+  // Always keep one byte for the null terminator
+  if (this->overflowed_ || this->pos_ + 1 >= this->capacity_) {
+    this->overflowed_ = true;
+    return;
+  }
+  this->buffer_[this->pos_++] = c;
+}
+
+void JsonWriter::write_(const char *data, size_t len) {
+  if (this->overflowed_ || this->pos_ + len >= this->capacity_) {
+    this->overflowed_ = true;
+    return;
+  }
+  std::memcpy(this->buffer_ + this->pos_, data, len);
+  this->pos_ += len;
+}
+
+void JsonWriter::write_escaped_(const char *data, size_t len) {
+  const char *run = data;
+  const char *end = data + len;
+  for (const char *p = data; p < end; p++) {
+    auto c = static_cast<uint8_t>(*p);
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    // Flush the run of characters that need no escaping in one copy
+    this->write_(run, p - run);
+    run = p + 1;
+    switch (c) {
+      case '"':
+        this->write_("\\\"", 2);
+        break;
+      case '\\':
+        this->write_("\\\\", 2);
+        break;
+      case '\n':
+        this->write_("\\n", 2);
+        break;
+      case '\r':
+        this->write_("\\r", 2);
+        break;
+      case '\t':
+        this->write_("\\t", 2);
+        break;
+      default: {
+        char esc[6] = {'\\', 'u', '0', '0', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0x0F]};
+        this->write_(esc, sizeof(esc));
+        break;
+      }
+    }
+  }
+  this->write_(run, end - run);
+}
+
+void JsonWriter::terminate_() {
+  if (this->capacity_ == 0)
+    return;
+  this->buffer_[this->pos_ < this->capacity_ ? this->pos_ : this->capacity_ - 1] = '\0';
+}
+
+void JsonWriter::prefix_(const char *key) {
+  if (this->depth_ > 0) {
+    uint8_t bit = 1 << (this->depth_ - 1);
+    if (this->needs_comma_ & bit) {
+      this->write_(',');
+    } else {
+      this->needs_comma_ |= bit;
+    }
+  }
+  if (key != nullptr) {
+    this->write_('"');
+    this->write_escaped_(key, strlen(key));
+    this->write_("\":", 2);
+  }
+}
+
+void JsonWriter::begin_object(const char *key) {
+  if (this->depth_ >= MAX_DEPTH) {
+    this->overflowed_ = true;
+    return;
+  }
+  this->prefix_(key);
+  this->write_('{');
+  this->depth_++;
+  this->needs_comma_ &= ~(1 << (this->depth_ - 1));
+  this->terminate_();
+}
+
+void JsonWriter::end_object() {
+  if (this->depth_ == 0)
+    return;
+  this->depth_--;
+  this->write_('}');
+  this->terminate_();
+}
+
+void JsonWriter::begin_array(const char *key) {
+  if (this->depth_ >= MAX_DEPTH) {
+    this->overflowed_ = true;
+    return;
+  }
+  this->prefix_(key);
+  this->write_('[');
+  this->depth_++;
+  this->needs_comma_ &= ~(1 << (this->depth_ - 1));
+  this->terminate_();
+}
+
+void JsonWriter::end_array() {
+  if (this->depth_ == 0)
+    return;
+  this->depth_--;
+  this->write_(']');
+  this->terminate_();
+}
+
+void JsonWriter::add(const char *key, const char *value) {
+  if (value == nullptr) {
+    this->add_null(key);
+    return;
+  }
+  this->add(key, value, strlen(value));
+}
+
+void JsonWriter::add(const char *key, const char *value, size_t len) {
+  this->prefix_(key);
+  this->write_('"');
+  this->write_escaped_(value, len);
+  this->write_('"');
+  this->terminate_();
+}
+
+void JsonWriter::add(const char *key, bool value) {
+  this->prefix_(key);
+  if (value) {
+    this->write_("true", 4);
+  } else {
+    this->write_("false", 5);
+  }
+  this->terminate_();
+}
+
+void JsonWriter::add(const char *key, int32_t value) {
+  char buf[12];
+  int len = snprintf(buf, sizeof(buf), "%" PRId32, value);
+  this->add_raw(key, buf, len);
+}
+
+void JsonWriter::add(const char *key, uint32_t value) {
+  char buf[11];
+  int len = snprintf(buf, sizeof(buf), "%" PRIu32, value);
+  this->add_raw(key, buf, len);
+}
+
+void JsonWriter::add(const char *key, float value) {
+  if (!std::isfinite(value)) {
+    this->add_null(key);
+    return;
+  }
+  // 7 significant digits round-trip the float for display purposes without printing binary noise
+  char buf[20];
+  int len = snprintf(buf, sizeof(buf), "%.7g", value);
+  this->add_raw(key, buf, len);
+}
+
+void JsonWriter::add_null(const char *key) { this->add_raw(key, "null", 4); }
+
+void JsonWriter::add_raw(const char *key, const char *json, size_t len) {
+  this->prefix_(key);
+  this->write_(json, len);
+  this->terminate_();
+}
+
+void JsonWriter::begin_string(const char *key) {
+  this->prefix_(key);
+  this->write_('"');
+}
+
+void JsonWriter::append_string(const char *value, size_t len) { this->write_escaped_(value, len); }
+
+void JsonWriter::append_string(const char *value) { this->write_escaped_(value, strlen(value)); }
+
+void JsonWriter::end_string() {
+  this->write_('"');
+  this->terminate_();
+}
+
+}  // namespace json
+}  // namespace esphome
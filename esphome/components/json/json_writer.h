@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "esphome/core/string_ref.h"
+
+namespace esphome {
+namespace json {
+
+/** Allocation-free streaming JSON writer.
+ *
+ * Serializes directly into a caller-provided buffer without building an intermediate document, which makes it suitable
+ * for small, hot documents such as web_server state events. Keys are written in call order and commas are inserted
+ * automatically. If the buffer is too small, writing stops, overflowed() returns true and the buffer holds a truncated
+ * (but still null-terminated) document.
+ *
+ * Example:
+ *   char buf[128];
+ *   JsonWriter writer(buf, sizeof(buf));
+ *   writer.begin_object();
+ *   writer.add("id", "sensor-temperature");
+ *   writer.add("value", 23.4f);
+ *   writer.end_object();
+ */
+class JsonWriter {
+ public:
+  /// Maximum nesting depth of objects/arrays.
+  static constexpr uint8_t MAX_DEPTH = 8;
+
+  JsonWriter(char *buffer, size_t size);
+
+  void begin_object(const char *key = nullptr);
+  void end_object();
+  void begin_array(const char *key = nullptr);
+  void end_array();
+
+  /// Add a string value. Pass key as nullptr for array elements.
+  void add(const char *key, const char *value);
+  void add(const char *key, const char *value, size_t len);
+  void add(const char *key, const StringRef &value) { this->add(key, value.c_str(), value.size()); }
+  void add(const char *key, const std::string &value) { this->add(key, value.data(), value.size()); }
+  void add(const char *key, bool value);
+  void add(const char *key, int32_t value);
+  void add(const char *key, uint32_t value);
+  /// Add a float; non-finite values are written as null, like ArduinoJson does.
+  void add(const char *key, float value);
+  void add_null(const char *key);
+  /// Add a pre-serialized JSON fragment verbatim.
+  void add_raw(const char *key, const char *json, size_t len);
+
+  /// Begin a string value that is assembled from several pieces (no escaping of quotes between pieces is needed).
+  void begin_string(const char *key);
+  /// Append escaped characters to a string started with begin_string().
+  void append_string(const char *value, size_t len);
+  void append_string(const char *value);
+  void end_string();
+
+  const char *c_str() const { return this->buffer_; }
+  size_t size() const { return this->pos_; }
+  bool overflowed() const { return this->overflowed_; }
+
+ protected:
+  void prefix_(const char *key);
+  void write_(char c);
+  void write_(const char *data, size_t len);
+  void write_escaped_(const char *data, size_t len);
+  void terminate_();
+
+  char *buffer_;
+  size_t capacity_;
+  size_t pos_{0};
+  /// Bit n set means the container at depth n already holds an element and needs a comma before the next one.
+  uint8_t needs_comma_{0};
+  uint8_t depth_{0};
+  bool overflowed_{false};
+};
+
+/// JsonWriter with an inline buffer, intended for stack allocation.
+template<size_t N> class StaticJsonWriter : public JsonWriter {
+ public:
+  StaticJsonWriter() : JsonWriter(this->storage_, N) {}
+  StaticJsonWriter(const StaticJsonWriter &) = delete;
+  StaticJsonWriter &operator=(const StaticJsonWriter &) = delete;
+
+ protected:
+  char storage_[N];
+};
+
+}  // namespace json
+}  // namespace esphome
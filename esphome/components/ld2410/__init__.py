@@ -73,6 +73,7 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     await uart.register_uart_device(var, config)
+    uart.request_wake_loop_on_rx()
 
 
 CALIBRATION_ACTION_SCHEMA = maybe_simple_id(
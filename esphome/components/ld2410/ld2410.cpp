@@ -168,6 +168,11 @@ static constexpr uint8_t CMD_FRAME_FOOTER[HEADER_FOOTER_SIZE] = {0x04, 0x03, 0x0
 // Data Header & Footer
 static constexpr uint8_t DATA_FRAME_HEADER[HEADER_FOOTER_SIZE] = {0xF4, 0xF3, 0xF2, 0xF1};
 static constexpr uint8_t DATA_FRAME_FOOTER[HEADER_FOOTER_SIZE] = {0xF8, 0xF7, 0xF6, 0xF5};
+// Frames the radar sends; both carry their payload length after the header
+static constexpr FrameFormat FRAME_FORMATS[] = {
+    {FRAME_TYPE_DATA, DATA_FRAME_HEADER, DATA_FRAME_FOOTER, 0},
+    {FRAME_TYPE_ACK, CMD_FRAME_HEADER, CMD_FRAME_FOOTER, 0},
+};
 // MAC address the module uses when Bluetooth is disabled
 static constexpr uint8_t NO_MAC[] = {0x08, 0x05, 0x04, 0x03, 0x02, 0x01};
 
@@ -247,7 +252,11 @@ void LD2410Component::dump_config() {
 #endif
 }
 
-void LD2410Component::setup() { this->read_all_info(); }
+void LD2410Component::setup() {
+  this->frame_parser_.set_formats(FRAME_FORMATS);
+  this->rx_listener_registered_ = this->register_rx_listener(this);
+  this->read_all_info();
+}
 
 void LD2410Component::read_all_info() {
   this->set_config_mode_(true);
@@ -272,8 +281,22 @@ void LD2410Component::restart_and_read_all_info() {
 }
 
 void LD2410Component::loop() {
-  while (this->available()) {
-    this->readline_(this->read());
+  uint8_t buffer[ld24xx::UART_READ_BUFFER_SIZE];
+  size_t len;
+  while ((len = this->read_available(buffer)) > 0) {
+    this->frame_parser_.feed(buffer, len, [this](const FrameFormat &format, std::span<const uint8_t> frame) {
+      if (format.type == FRAME_TYPE_DATA) {
+        ESP_LOGV(TAG, "Handling Periodic Data: %s", format_hex_pretty(frame.data(), frame.size()).c_str());
+        this->handle_periodic_data_(frame);
+      } else {
+        ESP_LOGV(TAG, "Handling Ack Data: %s", format_hex_pretty(frame.data(), frame.size()).c_str());
+        this->handle_ack_data_(frame);
+      }
+    });
+  }
+  if (this->rx_listener_registered_) {
+    // The UART re-enables the loop as soon as the next data or frame gap arrives
+    this->disable_loop();
   }
 }
 
@@ -301,12 +324,11 @@ void LD2410Component::send_command_(uint8_t command, const uint8_t *command_valu
   }
 }
 
-void LD2410Component::handle_periodic_data_() {
+void LD2410Component::handle_periodic_data_(std::span<const uint8_t> frame) {
   // 4 frame header bytes + 2 length bytes + 1 data end byte + 1 crc byte + 4 frame footer bytes
   // data header=0xAA, data footer=0x55, crc=0x00
-  if (this->buffer_pos_ < 12 || !ld2410::validate_header_footer(DATA_FRAME_HEADER, this->buffer_data_) ||
-      this->buffer_data_[7] != HEADER || this->buffer_data_[this->buffer_pos_ - 6] != FOOTER ||
-      this->buffer_data_[this->buffer_pos_ - 5] != CHECK) {
+  if (frame.size() < 12 || !ld2410::validate_header_footer(DATA_FRAME_HEADER, frame.data()) ||
+      frame[7] != HEADER || frame[frame.size() - 6] != FOOTER || frame[frame.size() - 5] != CHECK) {
     return;
   }
   /*
@@ -314,7 +336,7 @@ void LD2410Component::handle_periodic_data_() {
     0x01: Engineering mode
     0x02: Normal mode
   */
-  bool engineering_mode = this->buffer_data_[DATA_TYPES] == 0x01;
+  bool engineering_mode = frame[DATA_TYPES] == 0x01;
 #ifdef USE_SWITCH
   if (this->engineering_mode_switch_ != nullptr) {
     this->engineering_mode_switch_->publish_state(engineering_mode);
@@ -328,7 +350,7 @@ void LD2410Component::handle_periodic_data_() {
     0x02 = Still targets
     0x03 = Moving+Still targets
   */
-  char target_state = this->buffer_data_[TARGET_STATES];
+  char target_state = frame[TARGET_STATES];
   if (this->target_binary_sensor_ != nullptr) {
     this->target_binary_sensor_->publish_state(target_state != 0x00);
   }
@@ -349,15 +371,15 @@ void LD2410Component::handle_periodic_data_() {
 #ifdef USE_SENSOR
   SAFE_PUBLISH_SENSOR(
       this->moving_target_distance_sensor_,
-      ld2410::two_byte_to_int(this->buffer_data_[MOVING_TARGET_LOW], this->buffer_data_[MOVING_TARGET_HIGH]))
-  SAFE_PUBLISH_SENSOR(this->moving_target_energy_sensor_, this->buffer_data_[MOVING_ENERGY])
+      ld2410::two_byte_to_int(frame[MOVING_TARGET_LOW], frame[MOVING_TARGET_HIGH]))
+  SAFE_PUBLISH_SENSOR(this->moving_target_energy_sensor_, frame[MOVING_ENERGY])
   SAFE_PUBLISH_SENSOR(
       this->still_target_distance_sensor_,
-      ld2410::two_byte_to_int(this->buffer_data_[STILL_TARGET_LOW], this->buffer_data_[STILL_TARGET_HIGH]));
-  SAFE_PUBLISH_SENSOR(this->still_target_energy_sensor_, this->buffer_data_[STILL_ENERGY]);
+      ld2410::two_byte_to_int(frame[STILL_TARGET_LOW], frame[STILL_TARGET_HIGH]));
+  SAFE_PUBLISH_SENSOR(this->still_target_energy_sensor_, frame[STILL_ENERGY]);
   SAFE_PUBLISH_SENSOR(
       this->detection_distance_sensor_,
-      ld2410::two_byte_to_int(this->buffer_data_[DETECT_DISTANCE_LOW], this->buffer_data_[DETECT_DISTANCE_HIGH]));
+      ld2410::two_byte_to_int(frame[DETECT_DISTANCE_LOW], frame[DETECT_DISTANCE_HIGH]));
 
   if (engineering_mode) {
     /*
@@ -366,18 +388,18 @@ void LD2410Component::handle_periodic_data_() {
       Moving energy: 20~28th bytes
     */
     for (uint8_t i = 0; i < TOTAL_GATES; i++) {
-      SAFE_PUBLISH_SENSOR(this->gate_move_sensors_[i], this->buffer_data_[MOVING_SENSOR_START + i])
+      SAFE_PUBLISH_SENSOR(this->gate_move_sensors_[i], frame[MOVING_SENSOR_START + i])
     }
     /*
       Still energy: 29~37th bytes
     */
     for (uint8_t i = 0; i < TOTAL_GATES; i++) {
-      SAFE_PUBLISH_SENSOR(this->gate_still_sensors_[i], this->buffer_data_[STILL_SENSOR_START + i])
+      SAFE_PUBLISH_SENSOR(this->gate_still_sensors_[i], frame[STILL_SENSOR_START + i])
     }
     /*
       Light sensor: 38th bytes
     */
-    SAFE_PUBLISH_SENSOR(this->light_sensor_, this->buffer_data_[LIGHT_SENSOR])
+    SAFE_PUBLISH_SENSOR(this->light_sensor_, frame[LIGHT_SENSOR])
   } else {
     for (auto &gate_move_sensor : this->gate_move_sensors_) {
       SAFE_PUBLISH_SENSOR_UNKNOWN(gate_move_sensor)
@@ -391,7 +413,7 @@ void LD2410Component::handle_periodic_data_() {
 #ifdef USE_BINARY_SENSOR
   if (this->out_pin_presence_status_binary_sensor_ != nullptr) {
     this->out_pin_presence_status_binary_sensor_->publish_state(
-        engineering_mode ? this->buffer_data_[OUT_PIN_SENSOR] == 0x01 : false);
+        engineering_mode ? frame[OUT_PIN_SENSOR] == 0x01 : false);
   }
 #endif
 }
@@ -406,26 +428,26 @@ std::function<void(void)> set_number_value(number::Number *n, float value) {
 }
 #endif
 
-bool LD2410Component::handle_ack_data_() {
-  ESP_LOGV(TAG, "Handling ACK DATA for COMMAND %02X", this->buffer_data_[COMMAND]);
-  if (this->buffer_pos_ < 10) {
+void LD2410Component::handle_ack_data_(std::span<const uint8_t> frame) {
+  ESP_LOGV(TAG, "Handling ACK DATA for COMMAND %02X", frame[COMMAND]);
+  if (frame.size() < 10) {
     ESP_LOGE(TAG, "Invalid length");
-    return true;
+    return;
   }
-  if (!ld2410::validate_header_footer(CMD_FRAME_HEADER, this->buffer_data_)) {
-    ESP_LOGW(TAG, "Invalid header: %s", format_hex_pretty(this->buffer_data_, HEADER_FOOTER_SIZE).c_str());
-    return true;
+  if (!ld2410::validate_header_footer(CMD_FRAME_HEADER, frame.data())) {
+    ESP_LOGW(TAG, "Invalid header: %s", format_hex_pretty(frame.data(), HEADER_FOOTER_SIZE).c_str());
+    return;
   }
-  if (this->buffer_data_[COMMAND_STATUS] != 0x01) {
+  if (frame[COMMAND_STATUS] != 0x01) {
     ESP_LOGE(TAG, "Invalid status");
-    return true;
+    return;
   }
-  if (this->buffer_data_[8] || this->buffer_data_[9]) {
-    ESP_LOGW(TAG, "Invalid command: %02X, %02X", this->buffer_data_[8], this->buffer_data_[9]);
-    return true;
+  if (frame[8] || frame[9]) {
+    ESP_LOGW(TAG, "Invalid command: %02X, %02X", frame[8], frame[9]);
+    return;
   }
 
-  switch (this->buffer_data_[COMMAND]) {
+  switch (frame[COMMAND]) {
     case CMD_ENABLE_CONF:
       ESP_LOGV(TAG, "Enable conf");
       break;
@@ -444,7 +466,7 @@ bool LD2410Component::handle_ack_data_() {
       break;
 
     case CMD_QUERY_VERSION: {
-      std::memcpy(this->version_, &this->buffer_data_[12], sizeof(this->version_));
+      std::memcpy(this->version_, &frame[12], sizeof(this->version_));
       char version_s[20];
       ld24xx::format_version_str(this->version_, version_s);
       ESP_LOGV(TAG, "Firmware version: %s", version_s);
@@ -457,7 +479,7 @@ bool LD2410Component::handle_ack_data_() {
     }
 
     case CMD_QUERY_DISTANCE_RESOLUTION: {
-      const auto *distance_resolution = find_str(DISTANCE_RESOLUTIONS_BY_UINT, this->buffer_data_[10]);
+      const auto *distance_resolution = find_str(DISTANCE_RESOLUTIONS_BY_UINT, frame[10]);
       ESP_LOGV(TAG, "Distance resolution: %s", distance_resolution);
 #ifdef USE_SELECT
       if (this->distance_resolution_select_ != nullptr) {
@@ -468,9 +490,9 @@ bool LD2410Component::handle_ack_data_() {
     }
 
     case CMD_QUERY_LIGHT_CONTROL: {
-      this->light_function_ = this->buffer_data_[10];
-      this->light_threshold_ = this->buffer_data_[11];
-      this->out_pin_level_ = this->buffer_data_[12];
+      this->light_function_ = frame[10];
+      this->light_threshold_ = frame[11];
+      this->out_pin_level_ = frame[12];
       const auto *light_function_str = find_str(LIGHT_FUNCTIONS_BY_UINT, this->light_function_);
       const auto *out_pin_level_str = find_str(OUT_PIN_LEVELS_BY_UINT, this->out_pin_level_);
       ESP_LOGV(TAG,
@@ -494,13 +516,13 @@ bool LD2410Component::handle_ack_data_() {
       break;
     }
     case CMD_QUERY_MAC_ADDRESS: {
-      if (this->buffer_pos_ < 20) {
-        return false;
+      if (frame.size() < 20) {
+        return;
       }
 
-      this->bluetooth_on_ = std::memcmp(&this->buffer_data_[10], NO_MAC, sizeof(NO_MAC)) != 0;
+      this->bluetooth_on_ = std::memcmp(&frame[10], NO_MAC, sizeof(NO_MAC)) != 0;
       if (this->bluetooth_on_) {
-        std::memcpy(this->mac_address_, &this->buffer_data_[10], sizeof(this->mac_address_));
+        std::memcpy(this->mac_address_, &frame[10], sizeof(this->mac_address_));
       }
 
       char mac_s[18];
@@ -540,33 +562,33 @@ bool LD2410Component::handle_ack_data_() {
       break;
 
     case CMD_QUERY: {  // Query parameters response
-      if (this->buffer_data_[10] != HEADER)
-        return true;  // value head=0xAA
+      if (frame[10] != HEADER)
+        return;  // value head=0xAA
 #ifdef USE_NUMBER
       /*
         Moving distance range: 13th byte
         Still distance range: 14th byte
       */
       std::vector<std::function<void(void)>> updates;
-      updates.push_back(set_number_value(this->max_move_distance_gate_number_, this->buffer_data_[12]));
-      updates.push_back(set_number_value(this->max_still_distance_gate_number_, this->buffer_data_[13]));
+      updates.push_back(set_number_value(this->max_move_distance_gate_number_, frame[12]));
+      updates.push_back(set_number_value(this->max_still_distance_gate_number_, frame[13]));
       /*
         Moving Sensitivities: 15~23th bytes
       */
       for (std::vector<number::Number *>::size_type i = 0; i != this->gate_move_threshold_numbers_.size(); i++) {
-        updates.push_back(set_number_value(this->gate_move_threshold_numbers_[i], this->buffer_data_[14 + i]));
+        updates.push_back(set_number_value(this->gate_move_threshold_numbers_[i], frame[14 + i]));
       }
       /*
         Still Sensitivities: 24~32th bytes
       */
       for (std::vector<number::Number *>::size_type i = 0; i != this->gate_still_threshold_numbers_.size(); i++) {
-        updates.push_back(set_number_value(this->gate_still_threshold_numbers_[i], this->buffer_data_[23 + i]));
+        updates.push_back(set_number_value(this->gate_still_threshold_numbers_[i], frame[23 + i]));
       }
       /*
         None Duration: 33~34th bytes
       */
       updates.push_back(set_number_value(this->timeout_number_,
-                                         ld2410::two_byte_to_int(this->buffer_data_[32], this->buffer_data_[33])));
+                                         ld2410::two_byte_to_int(frame[32], frame[33])));
       for (auto &update : updates) {
         update();
       }
@@ -576,38 +598,6 @@ bool LD2410Component::handle_ack_data_() {
     default:
       break;
   }
-
-  return true;
-}
-
-void LD2410Component::readline_(int readch) {
-  if (readch < 0) {
-    return;  // No data available
-  }
-
-  if (this->buffer_pos_ < MAX_LINE_LENGTH - 1) {
-    this->buffer_data_[this->buffer_pos_++] = readch;
-    this->buffer_data_[this->buffer_pos_] = 0;
-  } else {
-    // We should never get here, but just in case...
-    ESP_LOGW(TAG, "Max command length exceeded; ignoring");
-    this->buffer_pos_ = 0;
-  }
-  if (this->buffer_pos_ < 4) {
-    return;  // Not enough data to process yet
-  }
-  if (ld2410::validate_header_footer(DATA_FRAME_FOOTER, &this->buffer_data_[this->buffer_pos_ - 4])) {
-    ESP_LOGV(TAG, "Handling Periodic Data: %s", format_hex_pretty(this->buffer_data_, this->buffer_pos_).c_str());
-    this->handle_periodic_data_();
-    this->buffer_pos_ = 0;  // Reset position index for next message
-  } else if (ld2410::validate_header_footer(CMD_FRAME_FOOTER, &this->buffer_data_[this->buffer_pos_ - 4])) {
-    ESP_LOGV(TAG, "Handling Ack Data: %s", format_hex_pretty(this->buffer_data_, this->buffer_pos_).c_str());
-    if (this->handle_ack_data_()) {
-      this->buffer_pos_ = 0;  // Reset position index for next message
-    } else {
-      ESP_LOGV(TAG, "Ack Data incomplete");
-    }
-  }
 }
 
 void LD2410Component::set_config_mode_(bool enable) {
@@ -772,12 +762,12 @@ void LD2410Component::set_light_out_control() {
 
 #ifdef USE_SENSOR
 // These could leak memory, but they are only set once prior to 'setup()' and should never be used again.
-void LD2410Component::set_gate_move_sensor(uint8_t gate, sensor::Sensor *s) {
-  this->gate_move_sensors_[gate] = new SensorWithDedup<uint8_t>(s);
+void LD2410Component::set_gate_move_sensor(uint8_t gate, sensor::Sensor *s, float publish_threshold) {
+  this->gate_move_sensors_[gate] = new SensorWithDedup<uint8_t>(s, publish_threshold);
 }
 
-void LD2410Component::set_gate_still_sensor(uint8_t gate, sensor::Sensor *s) {
-  this->gate_still_sensors_[gate] = new SensorWithDedup<uint8_t>(s);
+void LD2410Component::set_gate_still_sensor(uint8_t gate, sensor::Sensor *s, float publish_threshold) {
+  this->gate_still_sensors_[gate] = new SensorWithDedup<uint8_t>(s, publish_threshold);
 }
 #endif
 
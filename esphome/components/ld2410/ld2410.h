@@ -22,12 +22,14 @@
 #ifdef USE_TEXT_SENSOR
 #include "esphome/components/text_sensor/text_sensor.h"
 #endif
+#include "esphome/components/ld24xx/frame_parser.h"
 #include "esphome/components/ld24xx/ld24xx.h"
 #include "esphome/components/uart/uart.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/helpers.h"
 
 #include <array>
+#include <span>
 
 namespace esphome::ld2410 {
 
@@ -89,8 +91,8 @@ class LD2410Component : public Component, public uart::UARTDevice {
   void set_gate_threshold(uint8_t gate);
 #endif
 #ifdef USE_SENSOR
-  void set_gate_move_sensor(uint8_t gate, sensor::Sensor *s);
-  void set_gate_still_sensor(uint8_t gate, sensor::Sensor *s);
+  void set_gate_move_sensor(uint8_t gate, sensor::Sensor *s, float publish_threshold = 0);
+  void set_gate_still_sensor(uint8_t gate, sensor::Sensor *s, float publish_threshold = 0);
 #endif
   void set_bluetooth_password(const std::string &password);
   void set_engineering_mode(bool enable);
@@ -104,9 +106,8 @@ class LD2410Component : public Component, public uart::UARTDevice {
  protected:
   void send_command_(uint8_t command_str, const uint8_t *command_value, uint8_t command_value_len);
   void set_config_mode_(bool enable);
-  void handle_periodic_data_();
-  bool handle_ack_data_();
-  void readline_(int readch);
+  void handle_periodic_data_(std::span<const uint8_t> frame);
+  void handle_ack_data_(std::span<const uint8_t> frame);
   void query_parameters_();
   void get_version_();
   void get_mac_();
@@ -117,11 +118,11 @@ class LD2410Component : public Component, public uart::UARTDevice {
   uint8_t light_function_ = 0;
   uint8_t light_threshold_ = 0;
   uint8_t out_pin_level_ = 0;
-  uint8_t buffer_pos_ = 0;  // where to resume processing/populating buffer
-  uint8_t buffer_data_[MAX_LINE_LENGTH];
   uint8_t mac_address_[6] = {0, 0, 0, 0, 0, 0};
   uint8_t version_[6] = {0, 0, 0, 0, 0, 0};
   bool bluetooth_on_{false};
+  bool rx_listener_registered_{false};
+  StaticFrameParser<MAX_LINE_LENGTH> frame_parser_;
 #ifdef USE_NUMBER
   std::array<number::Number *, TOTAL_GATES> gate_move_threshold_numbers_{};
   std::array<number::Number *, TOTAL_GATES> gate_still_threshold_numbers_{};
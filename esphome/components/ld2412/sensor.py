@@ -1,5 +1,5 @@
 import esphome.codegen as cg
-from esphome.components import sensor
+from esphome.components import ld24xx
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_LIGHT,
@@ -29,7 +29,7 @@ CONF_STILL_ENERGY = "still_energy"
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(CONF_LD2412_ID): cv.use_id(LD2412Component),
-        cv.Optional(CONF_DETECTION_DISTANCE): sensor.sensor_schema(
+        cv.Optional(CONF_DETECTION_DISTANCE): ld24xx.sensor_schema(
             device_class=DEVICE_CLASS_DISTANCE,
             filters=[
                 {
@@ -43,7 +43,7 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_SIGNAL,
             unit_of_measurement=UNIT_CENTIMETER,
         ),
-        cv.Optional(CONF_LIGHT): sensor.sensor_schema(
+        cv.Optional(CONF_LIGHT): ld24xx.sensor_schema(
             device_class=DEVICE_CLASS_ILLUMINANCE,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
             filters=[
@@ -58,7 +58,7 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_LIGHTBULB,
             unit_of_measurement=UNIT_EMPTY,  # No standard unit for this light sensor
         ),
-        cv.Optional(CONF_MOVING_DISTANCE): sensor.sensor_schema(
+        cv.Optional(CONF_MOVING_DISTANCE): ld24xx.sensor_schema(
             device_class=DEVICE_CLASS_DISTANCE,
             filters=[
                 {
@@ -72,7 +72,7 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_SIGNAL,
             unit_of_measurement=UNIT_CENTIMETER,
         ),
-        cv.Optional(CONF_MOVING_ENERGY): sensor.sensor_schema(
+        cv.Optional(CONF_MOVING_ENERGY): ld24xx.sensor_schema(
             filters=[
                 {
                     "timeout": {
@@ -85,7 +85,7 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_MOTION_SENSOR,
             unit_of_measurement=UNIT_PERCENT,
         ),
-        cv.Optional(CONF_STILL_DISTANCE): sensor.sensor_schema(
+        cv.Optional(CONF_STILL_DISTANCE): ld24xx.sensor_schema(
             device_class=DEVICE_CLASS_DISTANCE,
             filters=[
                 {
@@ -99,7 +99,7 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_SIGNAL,
             unit_of_measurement=UNIT_CENTIMETER,
         ),
-        cv.Optional(CONF_STILL_ENERGY): sensor.sensor_schema(
+        cv.Optional(CONF_STILL_ENERGY): ld24xx.sensor_schema(
             filters=[
                 {
                     "timeout": {
@@ -119,7 +119,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
     {
         cv.Optional(f"gate_{x}"): (
             {
-                cv.Optional(CONF_MOVE_ENERGY): sensor.sensor_schema(
+                cv.Optional(CONF_MOVE_ENERGY): ld24xx.sensor_schema(
                     entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
                     filters=[
                         {
@@ -133,7 +133,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     icon=ICON_MOTION_SENSOR,
                     unit_of_measurement=UNIT_PERCENT,
                 ),
-                cv.Optional(CONF_STILL_ENERGY): sensor.sensor_schema(
+                cv.Optional(CONF_STILL_ENERGY): ld24xx.sensor_schema(
                     entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
                     filters=[
                         {
@@ -157,28 +157,28 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
 async def to_code(config):
     LD2412_component = await cg.get_variable(config[CONF_LD2412_ID])
     if detection_distance_config := config.get(CONF_DETECTION_DISTANCE):
-        sens = await sensor.new_sensor(detection_distance_config)
-        cg.add(LD2412_component.set_detection_distance_sensor(sens))
+        args = await ld24xx.new_sensor(detection_distance_config)
+        cg.add(LD2412_component.set_detection_distance_sensor(*args))
     if light_config := config.get(CONF_LIGHT):
-        sens = await sensor.new_sensor(light_config)
-        cg.add(LD2412_component.set_light_sensor(sens))
+        args = await ld24xx.new_sensor(light_config)
+        cg.add(LD2412_component.set_light_sensor(*args))
     if moving_distance_config := config.get(CONF_MOVING_DISTANCE):
-        sens = await sensor.new_sensor(moving_distance_config)
-        cg.add(LD2412_component.set_moving_target_distance_sensor(sens))
+        args = await ld24xx.new_sensor(moving_distance_config)
+        cg.add(LD2412_component.set_moving_target_distance_sensor(*args))
     if moving_energy_config := config.get(CONF_MOVING_ENERGY):
-        sens = await sensor.new_sensor(moving_energy_config)
-        cg.add(LD2412_component.set_moving_target_energy_sensor(sens))
+        args = await ld24xx.new_sensor(moving_energy_config)
+        cg.add(LD2412_component.set_moving_target_energy_sensor(*args))
     if still_distance_config := config.get(CONF_STILL_DISTANCE):
-        sens = await sensor.new_sensor(still_distance_config)
-        cg.add(LD2412_component.set_still_target_distance_sensor(sens))
+        args = await ld24xx.new_sensor(still_distance_config)
+        cg.add(LD2412_component.set_still_target_distance_sensor(*args))
     if still_energy_config := config.get(CONF_STILL_ENERGY):
-        sens = await sensor.new_sensor(still_energy_config)
-        cg.add(LD2412_component.set_still_target_energy_sensor(sens))
+        args = await ld24xx.new_sensor(still_energy_config)
+        cg.add(LD2412_component.set_still_target_energy_sensor(*args))
     for x in range(14):
         if gate_conf := config.get(f"gate_{x}"):
             if move_config := gate_conf.get(CONF_MOVE_ENERGY):
-                sens = await sensor.new_sensor(move_config)
-                cg.add(LD2412_component.set_gate_move_sensor(x, sens))
+                args = await ld24xx.new_sensor(move_config)
+                cg.add(LD2412_component.set_gate_move_sensor(x, *args))
             if still_config := gate_conf.get(CONF_STILL_ENERGY):
-                sens = await sensor.new_sensor(still_config)
-                cg.add(LD2412_component.set_gate_still_sensor(x, sens))
+                args = await ld24xx.new_sensor(still_config)
+                cg.add(LD2412_component.set_gate_still_sensor(x, *args))
@@ -3,6 +3,7 @@ from esphome.components import uart
 import esphome.config_validation as cv
 from esphome.const import CONF_ID
 
+AUTO_LOAD = ["ld24xx"]
 CODEOWNERS = ["@descipher"]
 
 DEPENDENCIES = ["uart"]
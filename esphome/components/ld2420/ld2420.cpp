@@ -1,7 +1,10 @@
 #include "ld2420.h"
+#include "esphome/components/ld24xx/ld24xx.h"
 #include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 
+#include <cstring>
+
 /*
 Configure commands - little endian
 
@@ -123,6 +126,16 @@ static const uint32_t DEBUG_FRAME_FOOTER = 0xFAFBFCFD;
 static const uint32_t DEBUG_FRAME_HEADER = 0x1410BFAA;
 static const uint32_t ENERGY_FRAME_FOOTER = 0xF5F6F7F8;
 static const uint32_t ENERGY_FRAME_HEADER = 0xF1F2F3F4;
+// The same headers and footers as they arrive on the wire
+static constexpr uint8_t CMD_FRAME_HEADER_BYTES[] = {0xFD, 0xFC, 0xFB, 0xFA};
+static constexpr uint8_t CMD_FRAME_FOOTER_BYTES[] = {0x04, 0x03, 0x02, 0x01};
+static constexpr uint8_t ENERGY_FRAME_HEADER_BYTES[] = {0xF4, 0xF3, 0xF2, 0xF1};
+static constexpr uint8_t ENERGY_FRAME_FOOTER_BYTES[] = {0xF8, 0xF7, 0xF6, 0xF5};
+// Frames the radar sends; both carry their payload length after the header. Simple mode sends text lines instead.
+static constexpr ld24xx::FrameFormat FRAME_FORMATS[] = {
+    {ld24xx::FRAME_TYPE_DATA, ENERGY_FRAME_HEADER_BYTES, ENERGY_FRAME_FOOTER_BYTES, 0},
+    {ld24xx::FRAME_TYPE_ACK, CMD_FRAME_HEADER_BYTES, CMD_FRAME_FOOTER_BYTES, 0},
+};
 static const int CALIBRATE_VERSION_MIN = 154;
 static const uint8_t CMD_FRAME_COMMAND = 6;
 static const uint8_t CMD_FRAME_DATA_LENGTH = 4;
@@ -214,6 +227,7 @@ void LD2420Component::dump_config() {
 }
 
 void LD2420Component::setup() {
+  this->frame_parser_.set_formats(FRAME_FORMATS);
   if (this->set_config_mode(true) == LD2420_ERROR_TIMEOUT) {
     ESP_LOGE(TAG, ESP_LOG_MSG_COMM_FAIL);
     this->mark_failed();
@@ -335,9 +349,8 @@ void LD2420Component::revert_config_action() {
 
 void LD2420Component::loop() {
   // If there is a active send command do not process it here, the send command call will handle it.
-  while (!this->cmd_active_ && this->available()) {
-    this->readline_(this->read(), this->buffer_data_, MAX_LINE_LENGTH);
-  }
+  if (!this->cmd_active_)
+    this->read_uart_();
 }
 
 void LD2420Component::update_radar_data(uint16_t const *gate_energy, uint8_t sample_number) {
@@ -425,47 +438,60 @@ void LD2420Component::set_operating_mode(const char *state) {
   }
 }
 
-void LD2420Component::readline_(int rx_data, uint8_t *buffer, int len) {
-  if (rx_data < 0) {
-    return;  // No data available
-  }
-  if (this->buffer_pos_ < len - 1) {
-    buffer[this->buffer_pos_++] = rx_data;
-    buffer[this->buffer_pos_] = 0;
-  } else {
-    // We should never get here, but just in case...
-    ESP_LOGW(TAG, "Max command length exceeded; ignoring");
-    this->buffer_pos_ = 0;
-  }
-  if (this->buffer_pos_ < 4) {
-    return;  // Not enough data to process yet
+void LD2420Component::read_uart_() {
+  uint8_t buffer[ld24xx::UART_READ_BUFFER_SIZE];
+  size_t len;
+  while ((len = this->read_available(buffer)) > 0) {
+    this->frame_parser_.feed(buffer, len, [this](const ld24xx::FrameFormat &format, std::span<const uint8_t> frame) {
+      if (format.type == ld24xx::FRAME_TYPE_ACK) {
+        this->cmd_active_ = false;  // Set command state to inactive after response
+        this->handle_ack_data_(frame);
+      } else if (this->get_mode_() == CMD_SYSTEM_MODE_ENERGY) {
+        this->handle_energy_mode_(frame);
+      }
+    });
+    if (this->get_mode_() == CMD_SYSTEM_MODE_SIMPLE)
+      this->read_lines_(buffer, len);
   }
-  if (memcmp(&buffer[this->buffer_pos_ - 4], &CMD_FRAME_FOOTER, sizeof(CMD_FRAME_FOOTER)) == 0) {
-    this->cmd_active_ = false;  // Set command state to inactive after response
-    this->handle_ack_data_(buffer, this->buffer_pos_);
-    this->buffer_pos_ = 0;
-  } else if ((buffer[this->buffer_pos_ - 2] == 0x0D && buffer[this->buffer_pos_ - 1] == 0x0A) &&
-             (this->get_mode_() == CMD_SYSTEM_MODE_SIMPLE)) {
-    this->handle_simple_mode_(buffer, this->buffer_pos_);
-    this->buffer_pos_ = 0;
-  } else if ((memcmp(&buffer[this->buffer_pos_ - 4], &ENERGY_FRAME_FOOTER, sizeof(ENERGY_FRAME_FOOTER)) == 0) &&
-             (this->get_mode_() == CMD_SYSTEM_MODE_ENERGY)) {
-    this->handle_energy_mode_(buffer, this->buffer_pos_);
-    this->buffer_pos_ = 0;
+}
+
+void LD2420Component::read_lines_(const uint8_t *data, size_t len) {
+  while (len > 0) {
+    const auto *end = static_cast<const uint8_t *>(std::memchr(data, '\n', len));
+    const size_t count = end == nullptr ? len : end - data + 1;
+    if (this->buffer_pos_ + count < MAX_LINE_LENGTH) {
+      std::memcpy(this->buffer_data_ + this->buffer_pos_, data, count);
+      this->buffer_pos_ += count;
+    } else {
+      // We should never get here, but just in case...
+      ESP_LOGW(TAG, "Max command length exceeded; ignoring");
+      this->buffer_pos_ = 0;
+    }
+    if (end != nullptr) {
+      if (this->buffer_pos_ >= 2 && this->buffer_data_[this->buffer_pos_ - 2] == 0x0D)
+        this->handle_simple_mode_(this->buffer_data_, this->buffer_pos_);
+      this->buffer_pos_ = 0;
+    }
+    data += count;
+    len -= count;
   }
 }
 
-void LD2420Component::handle_energy_mode_(uint8_t *buffer, int len) {
+void LD2420Component::handle_energy_mode_(std::span<const uint8_t> frame) {
   uint8_t index = 6;  // Start at presence byte position
   uint16_t range;
   const uint8_t elements = sizeof(this->gate_energy_) / sizeof(this->gate_energy_[0]);
-  this->set_presence_(buffer[index]);
+  if (frame.size() < index + 1 + sizeof(range) + sizeof(this->gate_energy_) + sizeof(ENERGY_FRAME_FOOTER_BYTES)) {
+    ESP_LOGW(TAG, "Energy frame too short");
+    return;
+  }
+  this->set_presence_(frame[index]);
   index++;
-  memcpy(&range, &buffer[index], sizeof(range));
+  memcpy(&range, &frame[index], sizeof(range));
   index += sizeof(range);
   this->set_distance_(range);
   for (uint8_t i = 0; i < elements; i++) {  // NOLINT
-    memcpy(&this->gate_energy_[i], &buffer[index], sizeof(this->gate_energy_[0]));
+    memcpy(&this->gate_energy_[i], &frame[index], sizeof(this->gate_energy_[0]));
     index += sizeof(this->gate_energy_[0]);
   }
 
@@ -539,7 +565,8 @@ void LD2420Component::handle_simple_mode_(const uint8_t *inbuf, int len) {
   }
 }
 
-void LD2420Component::handle_ack_data_(uint8_t *buffer, int len) {
+void LD2420Component::handle_ack_data_(std::span<const uint8_t> frame) {
+  const uint8_t *buffer = frame.data();
   this->cmd_reply_.command = buffer[CMD_FRAME_COMMAND];
   this->cmd_reply_.length = buffer[CMD_FRAME_DATA_LENGTH];
   uint8_t reg_element = 0;
@@ -610,7 +637,6 @@ void LD2420Component::handle_ack_data_(uint8_t *buffer, int len) {
 int LD2420Component::send_cmd_from_array(CmdFrameT frame) {
   uint32_t start_millis = millis();
   uint8_t error = 0;
-  uint8_t ack_buffer[MAX_LINE_LENGTH];
   uint8_t cmd_buffer[MAX_LINE_LENGTH];
   this->cmd_reply_.ack = false;
   if (frame.command != CMD_RESTART) {
@@ -645,9 +671,7 @@ int LD2420Component::send_cmd_from_array(CmdFrameT frame) {
     }
 
     while (!this->cmd_reply_.ack) {
-      while (this->available()) {
-        this->readline_(this->read(), ack_buffer, sizeof(ack_buffer));
-      }
+      this->read_uart_();
       delay_microseconds_safe(1450);
       // Wait on an Rx from the LD2420 for up to 3 1 second loops, otherwise it could trigger a WDT.
       if ((millis() - start_millis) > 1000) {
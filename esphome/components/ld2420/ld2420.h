@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/components/ld24xx/frame_parser.h"
 #include "esphome/components/uart/uart.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/helpers.h"
@@ -161,10 +162,13 @@ class LD2420Component : public Component, public uart::UARTDevice {
   void set_presence_(bool presence) { this->presence_ = presence; };
   uint16_t get_distance_() { return this->distance_; };
   void set_distance_(uint16_t distance) { this->distance_ = distance; };
+  /// Read everything the UART has buffered, handing complete frames and text lines to their handlers.
+  void read_uart_();
+  /// Collect the text lines of simple mode, which are not framed.
+  void read_lines_(const uint8_t *data, size_t len);
   void handle_simple_mode_(const uint8_t *inbuf, int len);
-  void handle_energy_mode_(uint8_t *buffer, int len);
-  void handle_ack_data_(uint8_t *buffer, int len);
-  void readline_(int rx_data, uint8_t *buffer, int len);
+  void handle_energy_mode_(std::span<const uint8_t> frame);
+  void handle_ack_data_(std::span<const uint8_t> frame);
   void set_calibration_(bool state) { this->calibration_ = state; };
   bool get_calibration_() { return this->calibration_; };
 
@@ -182,8 +186,9 @@ class LD2420Component : public Component, public uart::UARTDevice {
   uint16_t distance_{0};
   uint16_t system_mode_;
   uint16_t gate_energy_[TOTAL_GATES];
-  uint8_t buffer_pos_{0};  // where to resume processing/populating buffer
+  uint8_t buffer_pos_{0};  // where to resume populating the text line buffer
   uint8_t buffer_data_[MAX_LINE_LENGTH];
+  ld24xx::StaticFrameParser<MAX_LINE_LENGTH> frame_parser_;
   char firmware_ver_[8]{"v0.0.0"};
   bool cmd_active_{false};
   bool presence_{false};
@@ -127,6 +127,12 @@ static constexpr uint8_t CMD_FRAME_FOOTER[HEADER_FOOTER_SIZE] = {0x04, 0x03, 0x0
 // Data Header & Footer
 static constexpr uint8_t DATA_FRAME_HEADER[HEADER_FOOTER_SIZE] = {0xAA, 0xFF, 0x03, 0x00};
 static constexpr uint8_t DATA_FRAME_FOOTER[2] = {0x55, 0xCC};
+// Data frames have a fixed size: header, three 8 byte targets and footer
+static constexpr uint8_t DATA_FRAME_SIZE = 30;
+static constexpr FrameFormat FRAME_FORMATS[] = {
+    {FRAME_TYPE_DATA, DATA_FRAME_HEADER, DATA_FRAME_FOOTER, DATA_FRAME_SIZE},
+    {FRAME_TYPE_ACK, CMD_FRAME_HEADER, CMD_FRAME_FOOTER, 0},
+};
 // MAC address the module uses when Bluetooth is disabled
 static constexpr uint8_t NO_MAC[] = {0x08, 0x05, 0x04, 0x03, 0x02, 0x01};
 
@@ -179,6 +185,8 @@ static inline bool validate_header_footer(const uint8_t *header_footer, const ui
 }
 
 void LD2450Component::setup() {
+  this->frame_parser_.set_formats(FRAME_FORMATS);
+  this->rx_listener_registered_ = this->register_rx_listener(this);
 #ifdef USE_NUMBER
   if (this->presence_timeout_number_ != nullptr) {
     this->pref_ = global_preferences->make_preference<float>(this->presence_timeout_number_->get_preference_hash());
@@ -273,8 +281,22 @@ void LD2450Component::dump_config() {
 }
 
 void LD2450Component::loop() {
-  while (this->available()) {
-    this->readline_(this->read());
+  uint8_t buffer[ld24xx::UART_READ_BUFFER_SIZE];
+  size_t len;
+  while ((len = this->read_available(buffer)) > 0) {
+    this->frame_parser_.feed(buffer, len, [this](const FrameFormat &format, std::span<const uint8_t> frame) {
+      if (format.type == FRAME_TYPE_DATA) {
+        ESP_LOGV(TAG, "Handling Periodic Data: %s", format_hex_pretty(frame.data(), frame.size()).c_str());
+        this->handle_periodic_data_(frame);
+      } else {
+        ESP_LOGV(TAG, "Handling Ack Data: %s", format_hex_pretty(frame.data(), frame.size()).c_str());
+        this->handle_ack_data_(frame);
+      }
+    });
+  }
+  if (this->rx_listener_registered_) {
+    // The UART re-enables the loop as soon as the next data or frame gap arrives
+    this->disable_loop();
   }
 }
 
@@ -347,14 +369,14 @@ bool LD2450Component::get_timeout_status_(uint32_t check_millis) {
 }
 
 // Extract, store and publish zone details LD2450 buffer
-void LD2450Component::process_zone_() {
+void LD2450Component::process_zone_(std::span<const uint8_t> frame) {
   uint8_t index, start;
   for (index = 0; index < MAX_ZONES; index++) {
     start = 12 + index * 8;
-    this->zone_config_[index].x1 = ld2450::hex_to_signed_int(this->buffer_data_, start);
-    this->zone_config_[index].y1 = ld2450::hex_to_signed_int(this->buffer_data_, start + 2);
-    this->zone_config_[index].x2 = ld2450::hex_to_signed_int(this->buffer_data_, start + 4);
-    this->zone_config_[index].y2 = ld2450::hex_to_signed_int(this->buffer_data_, start + 6);
+    this->zone_config_[index].x1 = ld2450::hex_to_signed_int(frame.data(), start);
+    this->zone_config_[index].y1 = ld2450::hex_to_signed_int(frame.data(), start + 2);
+    this->zone_config_[index].x2 = ld2450::hex_to_signed_int(frame.data(), start + 4);
+    this->zone_config_[index].y2 = ld2450::hex_to_signed_int(frame.data(), start + 6);
 #ifdef USE_NUMBER
     // only one null check as all coordinates are required for a single zone
     if (this->zone_numbers_[index].x1 != nullptr) {
@@ -426,14 +448,13 @@ void LD2450Component::send_command_(uint8_t command, const uint8_t *command_valu
 // LD2450 Radar data message:
 //  [AA FF 03 00] [0E 03 B1 86 10 00 40 01] [00 00 00 00 00 00 00 00] [00 00 00 00 00 00 00 00] [55 CC]
 //   Header       Target 1                  Target 2                  Target 3                  End
-void LD2450Component::handle_periodic_data_() {
-  if (this->buffer_pos_ < 29) {  // header (4 bytes) + 8 x 3 target data + footer (2 bytes)
+void LD2450Component::handle_periodic_data_(std::span<const uint8_t> frame) {
+  if (frame.size() < 29) {  // header (4 bytes) + 8 x 3 target data + footer (2 bytes)
     ESP_LOGE(TAG, "Invalid length");
     return;
   }
-  if (!ld2450::validate_header_footer(DATA_FRAME_HEADER, this->buffer_data_) ||
-      this->buffer_data_[this->buffer_pos_ - 2] != DATA_FRAME_FOOTER[0] ||
-      this->buffer_data_[this->buffer_pos_ - 1] != DATA_FRAME_FOOTER[1]) {
+  if (!ld2450::validate_header_footer(DATA_FRAME_HEADER, frame.data()) ||
+      frame[frame.size() - 2] != DATA_FRAME_FOOTER[0] || frame[frame.size() - 1] != DATA_FRAME_FOOTER[1]) {
     ESP_LOGE(TAG, "Invalid header/footer");
     return;
   }
@@ -460,20 +481,20 @@ void LD2450Component::handle_periodic_data_() {
     start = TARGET_X + index * 8;
     is_moving = false;
     // tx is used for further calculations, so always needs to be populated
-    tx = ld2450::decode_coordinate(this->buffer_data_[start], this->buffer_data_[start + 1]);
+    tx = ld2450::decode_coordinate(frame[start], frame[start + 1]);
     SAFE_PUBLISH_SENSOR(this->move_x_sensors_[index], tx);
     // Y
     start = TARGET_Y + index * 8;
-    ty = ld2450::decode_coordinate(this->buffer_data_[start], this->buffer_data_[start + 1]);
+    ty = ld2450::decode_coordinate(frame[start], frame[start + 1]);
     SAFE_PUBLISH_SENSOR(this->move_y_sensors_[index], ty);
     // RESOLUTION
     start = TARGET_RESOLUTION + index * 8;
-    res = (this->buffer_data_[start + 1] << 8) | this->buffer_data_[start];
+    res = (frame[start + 1] << 8) | frame[start];
     SAFE_PUBLISH_SENSOR(this->move_resolution_sensors_[index], res);
 #endif
     // SPEED
     start = TARGET_SPEED + index * 8;
-    ts = ld2450::decode_speed(this->buffer_data_[start], this->buffer_data_[start + 1]);
+    ts = ld2450::decode_speed(frame[start], frame[start + 1]);
     if (ts) {
       is_moving = true;
       moving_target_count++;
@@ -600,26 +621,26 @@ void LD2450Component::handle_periodic_data_() {
 #endif
 }
 
-bool LD2450Component::handle_ack_data_() {
-  ESP_LOGV(TAG, "Handling ACK DATA for COMMAND %02X", this->buffer_data_[COMMAND]);
-  if (this->buffer_pos_ < 10) {
+void LD2450Component::handle_ack_data_(std::span<const uint8_t> frame) {
+  ESP_LOGV(TAG, "Handling ACK DATA for COMMAND %02X", frame[COMMAND]);
+  if (frame.size() < 10) {
     ESP_LOGE(TAG, "Invalid length");
-    return true;
+    return;
   }
-  if (!ld2450::validate_header_footer(CMD_FRAME_HEADER, this->buffer_data_)) {
-    ESP_LOGW(TAG, "Invalid header: %s", format_hex_pretty(this->buffer_data_, HEADER_FOOTER_SIZE).c_str());
-    return true;
+  if (!ld2450::validate_header_footer(CMD_FRAME_HEADER, frame.data())) {
+    ESP_LOGW(TAG, "Invalid header: %s", format_hex_pretty(frame.data(), HEADER_FOOTER_SIZE).c_str());
+    return;
   }
-  if (this->buffer_data_[COMMAND_STATUS] != 0x01) {
+  if (frame[COMMAND_STATUS] != 0x01) {
     ESP_LOGE(TAG, "Invalid status");
-    return true;
+    return;
   }
-  if (this->buffer_data_[8] || this->buffer_data_[9]) {
-    ESP_LOGW(TAG, "Invalid command: %02X, %02X", this->buffer_data_[8], this->buffer_data_[9]);
-    return true;
+  if (frame[8] || frame[9]) {
+    ESP_LOGW(TAG, "Invalid command: %02X, %02X", frame[8], frame[9]);
+    return;
   }
 
-  switch (this->buffer_data_[COMMAND]) {
+  switch (frame[COMMAND]) {
     case CMD_ENABLE_CONF:
       ESP_LOGV(TAG, "Enable conf");
       break;
@@ -638,7 +659,7 @@ bool LD2450Component::handle_ack_data_() {
       break;
 
     case CMD_QUERY_VERSION: {
-      std::memcpy(this->version_, &this->buffer_data_[12], sizeof(this->version_));
+      std::memcpy(this->version_, &frame[12], sizeof(this->version_));
       char version_s[20];
       ld24xx::format_version_str(this->version_, version_s);
       ESP_LOGV(TAG, "Firmware version: %s", version_s);
@@ -651,13 +672,13 @@ bool LD2450Component::handle_ack_data_() {
     }
 
     case CMD_QUERY_MAC_ADDRESS: {
-      if (this->buffer_pos_ < 20) {
-        return false;
+      if (frame.size() < 20) {
+        return;
       }
 
-      this->bluetooth_on_ = std::memcmp(&this->buffer_data_[10], NO_MAC, sizeof(NO_MAC)) != 0;
+      this->bluetooth_on_ = std::memcmp(&frame[10], NO_MAC, sizeof(NO_MAC)) != 0;
       if (this->bluetooth_on_) {
-        std::memcpy(this->mac_address_, &this->buffer_data_[10], sizeof(this->mac_address_));
+        std::memcpy(this->mac_address_, &frame[10], sizeof(this->mac_address_));
       }
 
       char mac_s[18];
@@ -702,30 +723,30 @@ bool LD2450Component::handle_ack_data_() {
       ESP_LOGV(TAG, "Query target tracking mode");
 #ifdef USE_SWITCH
       if (this->multi_target_switch_ != nullptr) {
-        this->multi_target_switch_->publish_state(this->buffer_data_[10] == 0x02);
+        this->multi_target_switch_->publish_state(frame[10] == 0x02);
       }
 #endif
       break;
 
     case CMD_QUERY_ZONE:
       ESP_LOGV(TAG, "Query zone conf");
-      this->zone_type_ = std::stoi(std::to_string(this->buffer_data_[10]), nullptr, 16);
+      this->zone_type_ = std::stoi(std::to_string(frame[10]), nullptr, 16);
       this->publish_zone_type();
 #ifdef USE_SELECT
       if (this->zone_type_select_ != nullptr) {
         ESP_LOGV(TAG, "Change zone type to: %s", this->zone_type_select_->current_option());
       }
 #endif
-      if (this->buffer_data_[10] == 0x00) {
+      if (frame[10] == 0x00) {
         ESP_LOGV(TAG, "Zone: Disabled");
       }
-      if (this->buffer_data_[10] == 0x01) {
+      if (frame[10] == 0x01) {
         ESP_LOGV(TAG, "Zone: Area detection");
       }
-      if (this->buffer_data_[10] == 0x02) {
+      if (frame[10] == 0x02) {
         ESP_LOGV(TAG, "Zone: Area filter");
       }
-      this->process_zone_();
+      this->process_zone_(frame);
       break;
 
     case CMD_SET_ZONE:
@@ -736,39 +757,6 @@ bool LD2450Component::handle_ack_data_() {
     default:
       break;
   }
-  return true;
-}
-
-// Read LD2450 buffer data
-void LD2450Component::readline_(int readch) {
-  if (readch < 0) {
-    return;  // No data available
-  }
-
-  if (this->buffer_pos_ < MAX_LINE_LENGTH - 1) {
-    this->buffer_data_[this->buffer_pos_++] = readch;
-    this->buffer_data_[this->buffer_pos_] = 0;
-  } else {
-    // We should never get here, but just in case...
-    ESP_LOGW(TAG, "Max command length exceeded; ignoring");
-    this->buffer_pos_ = 0;
-  }
-  if (this->buffer_pos_ < 4) {
-    return;  // Not enough data to process yet
-  }
-  if (this->buffer_data_[this->buffer_pos_ - 2] == DATA_FRAME_FOOTER[0] &&
-      this->buffer_data_[this->buffer_pos_ - 1] == DATA_FRAME_FOOTER[1]) {
-    ESP_LOGV(TAG, "Handling Periodic Data: %s", format_hex_pretty(this->buffer_data_, this->buffer_pos_).c_str());
-    this->handle_periodic_data_();
-    this->buffer_pos_ = 0;  // Reset position index for next frame
-  } else if (ld2450::validate_header_footer(CMD_FRAME_FOOTER, &this->buffer_data_[this->buffer_pos_ - 4])) {
-    ESP_LOGV(TAG, "Handling Ack Data: %s", format_hex_pretty(this->buffer_data_, this->buffer_pos_).c_str());
-    if (this->handle_ack_data_()) {
-      this->buffer_pos_ = 0;  // Reset position index for next message
-    } else {
-      ESP_LOGV(TAG, "Ack Data incomplete");
-    }
-  }
 }
 
 // Set Config Mode - Pre-requisite sending commands
@@ -847,32 +835,32 @@ void LD2450Component::query_zone_() { this->send_command_(CMD_QUERY_ZONE, nullpt
 
 #ifdef USE_SENSOR
 // These could leak memory, but they are only set once prior to 'setup()' and should never be used again.
-void LD2450Component::set_move_x_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_x_sensors_[target] = new SensorWithDedup<int16_t>(s);
+void LD2450Component::set_move_x_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold) {
+  this->move_x_sensors_[target] = new SensorWithDedup<int16_t>(s, publish_threshold);
 }
-void LD2450Component::set_move_y_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_y_sensors_[target] = new SensorWithDedup<int16_t>(s);
+void LD2450Component::set_move_y_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold) {
+  this->move_y_sensors_[target] = new SensorWithDedup<int16_t>(s, publish_threshold);
 }
-void LD2450Component::set_move_speed_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_speed_sensors_[target] = new SensorWithDedup<int16_t>(s);
+void LD2450Component::set_move_speed_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold) {
+  this->move_speed_sensors_[target] = new SensorWithDedup<int16_t>(s, publish_threshold);
 }
-void LD2450Component::set_move_angle_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_angle_sensors_[target] = new SensorWithDedup<float>(s);
+void LD2450Component::set_move_angle_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold) {
+  this->move_angle_sensors_[target] = new SensorWithDedup<float>(s, publish_threshold);
 }
-void LD2450Component::set_move_distance_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_distance_sensors_[target] = new SensorWithDedup<uint16_t>(s);
+void LD2450Component::set_move_distance_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold) {
+  this->move_distance_sensors_[target] = new SensorWithDedup<uint16_t>(s, publish_threshold);
 }
-void LD2450Component::set_move_resolution_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_resolution_sensors_[target] = new SensorWithDedup<uint16_t>(s);
+void LD2450Component::set_move_resolution_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold) {
+  this->move_resolution_sensors_[target] = new SensorWithDedup<uint16_t>(s, publish_threshold);
 }
-void LD2450Component::set_zone_target_count_sensor(uint8_t zone, sensor::Sensor *s) {
-  this->zone_target_count_sensors_[zone] = new SensorWithDedup<uint8_t>(s);
+void LD2450Component::set_zone_target_count_sensor(uint8_t zone, sensor::Sensor *s, float publish_threshold) {
+  this->zone_target_count_sensors_[zone] = new SensorWithDedup<uint8_t>(s, publish_threshold);
 }
-void LD2450Component::set_zone_still_target_count_sensor(uint8_t zone, sensor::Sensor *s) {
-  this->zone_still_target_count_sensors_[zone] = new SensorWithDedup<uint8_t>(s);
+void LD2450Component::set_zone_still_target_count_sensor(uint8_t zone, sensor::Sensor *s, float publish_threshold) {
+  this->zone_still_target_count_sensors_[zone] = new SensorWithDedup<uint8_t>(s, publish_threshold);
 }
-void LD2450Component::set_zone_moving_target_count_sensor(uint8_t zone, sensor::Sensor *s) {
-  this->zone_moving_target_count_sensors_[zone] = new SensorWithDedup<uint8_t>(s);
+void LD2450Component::set_zone_moving_target_count_sensor(uint8_t zone, sensor::Sensor *s, float publish_threshold) {
+  this->zone_moving_target_count_sensors_[zone] = new SensorWithDedup<uint8_t>(s, publish_threshold);
 }
 #endif
 #ifdef USE_TEXT_SENSOR
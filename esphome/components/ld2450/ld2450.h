@@ -24,12 +24,14 @@
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
 
+#include "esphome/components/ld24xx/frame_parser.h"
 #include "esphome/components/ld24xx/ld24xx.h"
 #include "esphome/components/uart/uart.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/preferences.h"
 
 #include <array>
+#include <span>
 
 namespace esphome::ld2450 {
 
@@ -126,15 +128,15 @@ class LD2450Component : public Component, public uart::UARTDevice {
   void set_zone_numbers(uint8_t zone, number::Number *x1, number::Number *y1, number::Number *x2, number::Number *y2);
 #endif
 #ifdef USE_SENSOR
-  void set_move_x_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_y_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_speed_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_angle_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_distance_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_resolution_sensor(uint8_t target, sensor::Sensor *s);
-  void set_zone_target_count_sensor(uint8_t zone, sensor::Sensor *s);
-  void set_zone_still_target_count_sensor(uint8_t zone, sensor::Sensor *s);
-  void set_zone_moving_target_count_sensor(uint8_t zone, sensor::Sensor *s);
+  void set_move_x_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold = 0);
+  void set_move_y_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold = 0);
+  void set_move_speed_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold = 0);
+  void set_move_angle_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold = 0);
+  void set_move_distance_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold = 0);
+  void set_move_resolution_sensor(uint8_t target, sensor::Sensor *s, float publish_threshold = 0);
+  void set_zone_target_count_sensor(uint8_t zone, sensor::Sensor *s, float publish_threshold = 0);
+  void set_zone_still_target_count_sensor(uint8_t zone, sensor::Sensor *s, float publish_threshold = 0);
+  void set_zone_moving_target_count_sensor(uint8_t zone, sensor::Sensor *s, float publish_threshold = 0);
 #endif
   void reset_radar_zone();
   void set_radar_zone(int32_t zone_type, int32_t zone1_x1, int32_t zone1_y1, int32_t zone1_x2, int32_t zone1_y2,
@@ -144,10 +146,9 @@ class LD2450Component : public Component, public uart::UARTDevice {
  protected:
   void send_command_(uint8_t command_str, const uint8_t *command_value, uint8_t command_value_len);
   void set_config_mode_(bool enable);
-  void handle_periodic_data_();
-  bool handle_ack_data_();
-  void process_zone_();
-  void readline_(int readch);
+  void handle_periodic_data_(std::span<const uint8_t> frame);
+  void handle_ack_data_(std::span<const uint8_t> frame);
+  void process_zone_(std::span<const uint8_t> frame);
   void get_version_();
   void get_mac_();
   void query_target_tracking_mode_();
@@ -163,12 +164,12 @@ class LD2450Component : public Component, public uart::UARTDevice {
   uint32_t still_presence_millis_ = 0;
   uint32_t moving_presence_millis_ = 0;
   uint16_t timeout_ = 5;
-  uint8_t buffer_data_[MAX_LINE_LENGTH];
   uint8_t mac_address_[6] = {0, 0, 0, 0, 0, 0};
   uint8_t version_[6] = {0, 0, 0, 0, 0, 0};
-  uint8_t buffer_pos_ = 0;  // where to resume processing/populating buffer
   uint8_t zone_type_ = 0;
   bool bluetooth_on_{false};
+  bool rx_listener_registered_{false};
+  StaticFrameParser<MAX_LINE_LENGTH> frame_parser_;
   Target target_info_[MAX_TARGETS];
   Zone zone_config_[MAX_ZONES];
 
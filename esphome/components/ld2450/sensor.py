@@ -1,5 +1,5 @@
 import esphome.codegen as cg
-from esphome.components import sensor
+from esphome.components import ld24xx
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ANGLE,
@@ -41,7 +41,7 @@ UNIT_MILLIMETER_PER_SECOND = "mm/s"
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(CONF_LD2450_ID): cv.use_id(LD2450Component),
-        cv.Optional(CONF_TARGET_COUNT): sensor.sensor_schema(
+        cv.Optional(CONF_TARGET_COUNT): ld24xx.sensor_schema(
             accuracy_decimals=0,
             filters=[
                 {
@@ -54,7 +54,7 @@ CONFIG_SCHEMA = cv.Schema(
             ],
             icon=ICON_ACCOUNT_GROUP,
         ),
-        cv.Optional(CONF_STILL_TARGET_COUNT): sensor.sensor_schema(
+        cv.Optional(CONF_STILL_TARGET_COUNT): ld24xx.sensor_schema(
             accuracy_decimals=0,
             filters=[
                 {
@@ -67,7 +67,7 @@ CONFIG_SCHEMA = cv.Schema(
             ],
             icon=ICON_HUMAN_GREETING_PROXIMITY,
         ),
-        cv.Optional(CONF_MOVING_TARGET_COUNT): sensor.sensor_schema(
+        cv.Optional(CONF_MOVING_TARGET_COUNT): ld24xx.sensor_schema(
             accuracy_decimals=0,
             filters=[
                 {
@@ -87,7 +87,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
     {
         cv.Optional(f"target_{n + 1}"): cv.Schema(
             {
-                cv.Optional(CONF_X): sensor.sensor_schema(
+                cv.Optional(CONF_X): ld24xx.sensor_schema(
                     device_class=DEVICE_CLASS_DISTANCE,
                     filters=[
                         {
@@ -101,7 +101,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     icon=ICON_ALPHA_X_BOX_OUTLINE,
                     unit_of_measurement=UNIT_MILLIMETER,
                 ),
-                cv.Optional(CONF_Y): sensor.sensor_schema(
+                cv.Optional(CONF_Y): ld24xx.sensor_schema(
                     device_class=DEVICE_CLASS_DISTANCE,
                     filters=[
                         {
@@ -115,7 +115,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     icon=ICON_ALPHA_Y_BOX_OUTLINE,
                     unit_of_measurement=UNIT_MILLIMETER,
                 ),
-                cv.Optional(CONF_SPEED): sensor.sensor_schema(
+                cv.Optional(CONF_SPEED): ld24xx.sensor_schema(
                     device_class=DEVICE_CLASS_SPEED,
                     filters=[
                         {
@@ -129,7 +129,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     icon=ICON_SPEEDOMETER_SLOW,
                     unit_of_measurement=UNIT_MILLIMETER_PER_SECOND,
                 ),
-                cv.Optional(CONF_ANGLE): sensor.sensor_schema(
+                cv.Optional(CONF_ANGLE): ld24xx.sensor_schema(
                     filters=[
                         {
                             "timeout": {
@@ -142,7 +142,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     icon=ICON_FORMAT_TEXT_ROTATION_ANGLE_UP,
                     unit_of_measurement=UNIT_DEGREES,
                 ),
-                cv.Optional(CONF_DISTANCE): sensor.sensor_schema(
+                cv.Optional(CONF_DISTANCE): ld24xx.sensor_schema(
                     device_class=DEVICE_CLASS_DISTANCE,
                     filters=[
                         {
@@ -156,7 +156,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     icon=ICON_MAP_MARKER_DISTANCE,
                     unit_of_measurement=UNIT_MILLIMETER,
                 ),
-                cv.Optional(CONF_RESOLUTION): sensor.sensor_schema(
+                cv.Optional(CONF_RESOLUTION): ld24xx.sensor_schema(
                     device_class=DEVICE_CLASS_DISTANCE,
                     filters=[
                         {
@@ -177,7 +177,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
     {
         cv.Optional(f"zone_{n + 1}"): cv.Schema(
             {
-                cv.Optional(CONF_TARGET_COUNT): sensor.sensor_schema(
+                cv.Optional(CONF_TARGET_COUNT): ld24xx.sensor_schema(
                     accuracy_decimals=0,
                     filters=[
                         {
@@ -190,7 +190,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     ],
                     icon=ICON_MAP_MARKER_ACCOUNT,
                 ),
-                cv.Optional(CONF_STILL_TARGET_COUNT): sensor.sensor_schema(
+                cv.Optional(CONF_STILL_TARGET_COUNT): ld24xx.sensor_schema(
                     accuracy_decimals=0,
                     filters=[
                         {
@@ -203,7 +203,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     ],
                     icon=ICON_MAP_MARKER_ACCOUNT,
                 ),
-                cv.Optional(CONF_MOVING_TARGET_COUNT): sensor.sensor_schema(
+                cv.Optional(CONF_MOVING_TARGET_COUNT): ld24xx.sensor_schema(
                     accuracy_decimals=0,
                     filters=[
                         {
@@ -227,44 +227,44 @@ async def to_code(config):
     ld2450_component = await cg.get_variable(config[CONF_LD2450_ID])
 
     if target_count_config := config.get(CONF_TARGET_COUNT):
-        sens = await sensor.new_sensor(target_count_config)
-        cg.add(ld2450_component.set_target_count_sensor(sens))
+        args = await ld24xx.new_sensor(target_count_config)
+        cg.add(ld2450_component.set_target_count_sensor(*args))
 
     if still_target_count_config := config.get(CONF_STILL_TARGET_COUNT):
-        sens = await sensor.new_sensor(still_target_count_config)
-        cg.add(ld2450_component.set_still_target_count_sensor(sens))
+        args = await ld24xx.new_sensor(still_target_count_config)
+        cg.add(ld2450_component.set_still_target_count_sensor(*args))
 
     if moving_target_count_config := config.get(CONF_MOVING_TARGET_COUNT):
-        sens = await sensor.new_sensor(moving_target_count_config)
-        cg.add(ld2450_component.set_moving_target_count_sensor(sens))
+        args = await ld24xx.new_sensor(moving_target_count_config)
+        cg.add(ld2450_component.set_moving_target_count_sensor(*args))
     for n in range(MAX_TARGETS):
         if target_conf := config.get(f"target_{n + 1}"):
             if x_config := target_conf.get(CONF_X):
-                sens = await sensor.new_sensor(x_config)
-                cg.add(ld2450_component.set_move_x_sensor(n, sens))
+                args = await ld24xx.new_sensor(x_config)
+                cg.add(ld2450_component.set_move_x_sensor(n, *args))
             if y_config := target_conf.get(CONF_Y):
-                sens = await sensor.new_sensor(y_config)
-                cg.add(ld2450_component.set_move_y_sensor(n, sens))
+                args = await ld24xx.new_sensor(y_config)
+                cg.add(ld2450_component.set_move_y_sensor(n, *args))
             if speed_config := target_conf.get(CONF_SPEED):
-                sens = await sensor.new_sensor(speed_config)
-                cg.add(ld2450_component.set_move_speed_sensor(n, sens))
+                args = await ld24xx.new_sensor(speed_config)
+                cg.add(ld2450_component.set_move_speed_sensor(n, *args))
             if angle_config := target_conf.get(CONF_ANGLE):
-                sens = await sensor.new_sensor(angle_config)
-                cg.add(ld2450_component.set_move_angle_sensor(n, sens))
+                args = await ld24xx.new_sensor(angle_config)
+                cg.add(ld2450_component.set_move_angle_sensor(n, *args))
             if distance_config := target_conf.get(CONF_DISTANCE):
-                sens = await sensor.new_sensor(distance_config)
-                cg.add(ld2450_component.set_move_distance_sensor(n, sens))
+                args = await ld24xx.new_sensor(distance_config)
+                cg.add(ld2450_component.set_move_distance_sensor(n, *args))
             if resolution_config := target_conf.get(CONF_RESOLUTION):
-                sens = await sensor.new_sensor(resolution_config)
-                cg.add(ld2450_component.set_move_resolution_sensor(n, sens))
+                args = await ld24xx.new_sensor(resolution_config)
+                cg.add(ld2450_component.set_move_resolution_sensor(n, *args))
     for n in range(MAX_ZONES):
         if zone_config := config.get(f"zone_{n + 1}"):
             if target_count_config := zone_config.get(CONF_TARGET_COUNT):
-                sens = await sensor.new_sensor(target_count_config)
-                cg.add(ld2450_component.set_zone_target_count_sensor(n, sens))
+                args = await ld24xx.new_sensor(target_count_config)
+                cg.add(ld2450_component.set_zone_target_count_sensor(n, *args))
             if still_target_count_config := zone_config.get(CONF_STILL_TARGET_COUNT):
-                sens = await sensor.new_sensor(still_target_count_config)
-                cg.add(ld2450_component.set_zone_still_target_count_sensor(n, sens))
+                args = await ld24xx.new_sensor(still_target_count_config)
+                cg.add(ld2450_component.set_zone_still_target_count_sensor(n, *args))
             if moving_target_count_config := zone_config.get(CONF_MOVING_TARGET_COUNT):
-                sens = await sensor.new_sensor(moving_target_count_config)
-                cg.add(ld2450_component.set_zone_moving_target_count_sensor(n, sens))
+                args = await ld24xx.new_sensor(moving_target_count_config)
+                cg.add(ld2450_component.set_zone_moving_target_count_sensor(n, *args))
@@ -1 +1,25 @@
+from esphome.components import sensor
+import esphome.config_validation as cv
+
 CODEOWNERS = ["@kbx81"]
+
+CONF_PUBLISH_THRESHOLD = "publish_threshold"
+
+
+def sensor_schema(**kwargs) -> cv.Schema:
+    """Sensor schema for values decoded from radar frames.
+
+    ``publish_threshold`` is the minimum change from the last published value before a
+    new state is published; by default every change is published.
+    """
+    return sensor.sensor_schema(**kwargs).extend(
+        {cv.Optional(CONF_PUBLISH_THRESHOLD): cv.positive_float}
+    )
+
+
+async def new_sensor(config) -> tuple:
+    """Create a sensor from ``sensor_schema`` and return its setter arguments."""
+    sens = await sensor.new_sensor(config)
+    if (threshold := config.get(CONF_PUBLISH_THRESHOLD)) is not None:
+        return sens, threshold
+    return (sens,)
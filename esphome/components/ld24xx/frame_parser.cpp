@@ -0,0 +1,126 @@
+#include "frame_parser.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome::ld24xx {
+
+static const char *const TAG = "ld24xx";
+
+void FrameParser::set_formats(std::span<const FrameFormat> formats) {
+  this->formats_ = formats;
+  this->num_leads_ = 0;
+  for (const auto &format : formats) {
+    const uint8_t lead = format.header[0];
+    if (std::find(this->leads_, this->leads_ + this->num_leads_, lead) == this->leads_ + this->num_leads_ &&
+        this->num_leads_ < MAX_FRAME_FORMATS) {
+      this->leads_[this->num_leads_++] = lead;
+    }
+  }
+  this->pos_ = 0;
+  this->need_ = FRAME_HEADER_SIZE;
+  this->frame_size_ = 0;
+  this->stage_ = Stage::HEADER;
+}
+
+size_t HOT FrameParser::find_lead_(const uint8_t *data, size_t len) const {
+  for (size_t i = 0; i < len; i++) {
+    for (uint8_t k = 0; k < this->num_leads_; k++) {
+      if (data[i] == this->leads_[k])
+        return i;
+    }
+  }
+  return len;
+}
+
+void FrameParser::discard_(size_t count) {
+  const uint8_t *rest = this->buffer_ + count;
+  size_t remaining = this->pos_ - count;
+  const size_t skip = this->find_lead_(rest, remaining);
+  this->discarded_bytes_ += skip;
+  remaining -= skip;
+  std::memmove(this->buffer_, rest + skip, remaining);
+  this->pos_ = remaining;
+  this->need_ = FRAME_HEADER_SIZE;
+  this->stage_ = Stage::HEADER;
+}
+
+bool FrameParser::advance_() {
+  switch (this->stage_) {
+    case Stage::HEADER:
+      for (const auto &format : this->formats_) {
+        if (std::memcmp(format.header.data(), this->buffer_, FRAME_HEADER_SIZE) == 0) {
+          this->format_ = &format;
+          if (format.fixed_size == 0) {
+            this->stage_ = Stage::LENGTH;
+            this->need_ = FRAME_HEADER_SIZE + FRAME_LENGTH_SIZE;
+            return false;
+          }
+          this->stage_ = Stage::FRAME;
+          this->need_ = format.fixed_size;
+          return false;
+        }
+      }
+      break;
+
+    case Stage::LENGTH: {
+      const size_t size = FRAME_HEADER_SIZE + FRAME_LENGTH_SIZE +
+                          encode_uint16(this->buffer_[FRAME_HEADER_SIZE + 1], this->buffer_[FRAME_HEADER_SIZE]) +
+                          this->format_->footer.size();
+      if (size <= this->capacity_) {
+        this->stage_ = Stage::FRAME;
+        this->need_ = size;
+        return false;
+      }
+      ESP_LOGV(TAG, "Frame of %zu bytes exceeds buffer", size);
+      break;
+    }
+
+    case Stage::FRAME: {
+      const auto &footer = this->format_->footer;
+      if (std::memcmp(this->buffer_ + this->need_ - footer.size(), footer.data(), footer.size()) == 0) {
+        this->frame_size_ = this->need_;
+        return true;
+      }
+      ESP_LOGV(TAG, "Invalid frame footer");
+      break;
+    }
+  }
+  // Not a valid frame after all; the next header may start within the bytes already read
+  this->discarded_bytes_++;
+  this->discard_(1);
+  return false;
+}
+
+size_t HOT FrameParser::consume_(const uint8_t *data, size_t len) {
+  if (this->frame_size_ != 0) {
+    // The previous frame has been handled; keep whatever was buffered behind it
+    this->discard_(this->frame_size_);
+    this->frame_size_ = 0;
+  }
+  size_t used = 0;
+  while (true) {
+    while (this->pos_ >= this->need_) {
+      if (this->advance_())
+        return used;
+    }
+    if (used == len)
+      return used;
+    if (this->pos_ == 0) {
+      const size_t skip = this->find_lead_(data + used, len - used);
+      this->discarded_bytes_ += skip;
+      used += skip;
+      if (used == len)
+        return used;
+    }
+    const size_t take = std::min(len - used, this->need_ - this->pos_);
+    std::memcpy(this->buffer_ + this->pos_, data + used, take);
+    this->pos_ += take;
+    used += take;
+  }
+}
+
+}  // namespace esphome::ld24xx
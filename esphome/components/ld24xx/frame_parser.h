@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace esphome::ld24xx {
+
+static constexpr uint8_t FRAME_HEADER_SIZE = 4;
+static constexpr uint8_t FRAME_LENGTH_SIZE = 2;
+static constexpr uint8_t MAX_FRAME_FORMATS = 4;
+
+enum FrameType : uint8_t {
+  FRAME_TYPE_DATA,
+  FRAME_TYPE_ACK,
+};
+
+/// Layout of one kind of frame sent by a radar.
+struct FrameFormat {
+  FrameType type;
+  std::span<const uint8_t, FRAME_HEADER_SIZE> header;
+  std::span<const uint8_t> footer;
+  /// Total size of frames that carry no length field; 0 if a little-endian payload length follows the header.
+  uint8_t fixed_size;
+};
+
+/** Splits the byte stream of an LD24xx radar into frames.
+ *
+ * Bytes are copied into the frame buffer in bulk: the parser searches for the first byte of a header, then reads up
+ * to the header, the length field and the end of the frame in turn. A frame is only handed on if its header, length
+ * and footer all match one of the formats, so the decoders never see partial or oversized frames. When a candidate
+ * frame turns out to be invalid, parsing resumes at the next possible header inside the bytes already buffered.
+ */
+class FrameParser {
+ public:
+  /// Set the frame formats to look for. The formats must outlive the parser.
+  void set_formats(std::span<const FrameFormat> formats);
+
+  /// Parse len bytes, calling on_frame(const FrameFormat &, std::span<const uint8_t>) for each complete frame.
+  template<typename F> void feed(const uint8_t *data, size_t len, F &&on_frame) {
+    while (len > 0 || this->frame_size_ != 0) {
+      size_t used = this->consume_(data, len);
+      data += used;
+      len -= used;
+      if (this->frame_size_ != 0)
+        on_frame(*this->format_, std::span<const uint8_t>(this->buffer_, this->frame_size_));
+    }
+  }
+
+  /// Number of bytes dropped while searching for a valid frame.
+  uint32_t get_discarded_bytes() const { return this->discarded_bytes_; }
+
+ protected:
+  FrameParser(uint8_t *buffer, size_t capacity) : buffer_(buffer), capacity_(capacity) {}
+
+  /// Consume bytes until a frame is complete or the input is exhausted; returns the number of bytes used.
+  size_t consume_(const uint8_t *data, size_t len);
+  /// Check the buffered bytes once need_ of them are available; returns true if a frame is complete.
+  bool advance_();
+  /// Drop count bytes from the front of the buffer and resume at the next possible header.
+  void discard_(size_t count);
+  /// Offset of the first byte in data that can start a header, or len if there is none.
+  size_t find_lead_(const uint8_t *data, size_t len) const;
+
+  enum class Stage : uint8_t {
+    HEADER,
+    LENGTH,
+    FRAME,
+  };
+
+  uint8_t *buffer_;
+  size_t capacity_;
+  std::span<const FrameFormat> formats_;
+  const FrameFormat *format_{nullptr};
+  size_t pos_{0};
+  size_t need_{FRAME_HEADER_SIZE};
+  size_t frame_size_{0};
+  uint32_t discarded_bytes_{0};
+  Stage stage_{Stage::HEADER};
+  uint8_t leads_[MAX_FRAME_FORMATS]{};
+  uint8_t num_leads_{0};
+};
+
+/// Frame parser with room for frames of up to N bytes.
+template<size_t N> class StaticFrameParser : public FrameParser {
+ public:
+  StaticFrameParser() : FrameParser(this->storage_, N) {}
+
+ protected:
+  uint8_t storage_[N];
+};
+
+}  // namespace esphome::ld24xx
@@ -3,6 +3,7 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
+#include <cmath>
 #include <memory>
 #include <span>
 
@@ -14,8 +15,8 @@
   ld24xx::SensorWithDedup<dedup_type> *name##_sensor_{nullptr}; \
 \
  public: \
-  void set_##name##_sensor(sensor::Sensor *sensor) { \
-    this->name##_sensor_ = new ld24xx::SensorWithDedup<dedup_type>(sensor); \
+  void set_##name##_sensor(sensor::Sensor *sensor, float publish_threshold = 0) { \
+    this->name##_sensor_ = new ld24xx::SensorWithDedup<dedup_type>(sensor, publish_threshold); \
   }
 #endif
 
@@ -39,6 +40,8 @@
 
 namespace esphome::ld24xx {
 
+// Bytes drained from the UART per bulk read in the radars' loop()
+static constexpr size_t UART_READ_BUFFER_SIZE = 64;
 static const char *const UNKNOWN_MAC = "unknown";
 static const char *const VERSION_FMT = "%u.%02X.%02X%02X%02X%02X";
 
@@ -61,25 +64,39 @@ inline void format_version_str(const uint8_t *version, std::span<char, 20> buffe
 }
 
 #ifdef USE_SENSOR
-// Helper class to store a sensor with a deduplicator & publish state only when the value changes
+// Helper class to store a sensor with a deduplicator & publish state only when the value changes.
+// With a publish threshold, the value must also have moved at least that far from the last published one.
 template<typename T> class SensorWithDedup {
  public:
-  SensorWithDedup(sensor::Sensor *sens) : sens(sens) {}
+  SensorWithDedup(sensor::Sensor *sens, float publish_threshold = 0)
+      : sens(sens), publish_threshold(publish_threshold) {}
 
   void publish_state_if_not_dup(T state) {
-    if (this->publish_dedup.next(state)) {
-      this->sens->publish_state(static_cast<float>(state));
+    if (this->published_ && !this->unknown_ &&
+        (state == this->last_value_ ||
+         std::fabs(static_cast<float>(state) - static_cast<float>(this->last_value_)) < this->publish_threshold)) {
+      return;
     }
+    this->published_ = true;
+    this->unknown_ = false;
+    this->last_value_ = state;
+    this->sens->publish_state(static_cast<float>(state));
   }
 
   void publish_state_unknown() {
-    if (this->publish_dedup.next_unknown()) {
+    if (!this->unknown_) {
+      this->unknown_ = true;
       this->sens->publish_state(NAN);
     }
   }
 
   sensor::Sensor *sens;
-  Deduplicator<T> publish_dedup;
+  float publish_threshold;
+
+ protected:
+  T last_value_{};
+  bool published_{false};
+  bool unknown_{false};
 };
 #endif
 }  // namespace esphome::ld24xx
@@ -1,6 +1,8 @@
 #include "addressable_light.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome::light {
 
 static const char *const TAG = "light.addressable";
@@ -26,6 +28,37 @@ std::unique_ptr<LightTransformer> AddressableLight::create_default_transition()
   return make_unique<AddressableLightTransformer>(*this);
 }
 
+bool AddressableLight::get_pixel_layout(ESPPixelLayout &layout) const {
+  const int32_t size = this->size();
+  if (size == 0)
+    return false;
+  const ESPColorView first = this->get_view_internal(0);
+  uint8_t *data = std::min({first.red_, first.green_, first.blue_});
+  if (first.white_ != nullptr)
+    data = std::min(data, first.white_);
+  const ptrdiff_t red = first.red_ - data;
+  const ptrdiff_t green = first.green_ - data;
+  const ptrdiff_t blue = first.blue_ - data;
+  const ptrdiff_t white = first.white_ == nullptr ? -1 : first.white_ - data;
+  const ptrdiff_t width = std::max({red, green, blue, white}) + 1;
+  const ptrdiff_t stride = size == 1 ? width : this->get_view_internal(1).red_ - first.red_;
+  if (width > 4 || stride < width)
+    return false;
+
+  // Lights may split their buffer or reorder pixels, so every view has to match
+  for (int32_t i = 0; i < size; i++) {
+    const ESPColorView view = this->get_view_internal(i);
+    uint8_t *pixel = data + i * stride;
+    if (view.red_ != pixel + red || view.green_ != pixel + green || view.blue_ != pixel + blue)
+      return false;
+    if ((view.white_ == nullptr) != (white < 0) || (white >= 0 && view.white_ != pixel + white))
+      return false;
+  }
+  layout = {data, static_cast<size_t>(stride), static_cast<uint8_t>(red), static_cast<uint8_t>(green),
+            static_cast<uint8_t>(blue), static_cast<int8_t>(white)};
+  return true;
+}
+
 Color color_from_light_color_values(LightColorValues val) {
   auto r = to_uint8_scale(val.get_color_brightness() * val.get_red());
   auto g = to_uint8_scale(val.get_color_brightness() * val.get_green());
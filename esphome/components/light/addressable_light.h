@@ -25,6 +25,16 @@ class AddressableLightState : public LightState {
   using LightState::LightState;
 };
 
+/// Where the bytes of each pixel are found in an addressable light's output buffer.
+struct ESPPixelLayout {
+  uint8_t *data;  ///< First byte of the first pixel
+  size_t stride;  ///< Distance between the starts of two pixels, in bytes
+  uint8_t red;    ///< Offset of the red byte within a pixel
+  uint8_t green;  ///< Offset of the green byte within a pixel
+  uint8_t blue;   ///< Offset of the blue byte within a pixel
+  int8_t white;   ///< Offset of the white byte within a pixel, or -1 if the light has no white channel
+};
+
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
@@ -71,6 +81,11 @@ class AddressableLight : public LightOutput, public Component {
   }
   void update_state(LightState *state) override;
   void schedule_show() { this->state_parent_->schedule_write_(); }
+  const ESPColorCorrection &get_correction() const { return this->correction_; }
+  /// Describe the output buffer so that it can be filled without going through an ESPColorView per pixel.
+  /// Bytes written this way must already be color corrected, see get_correction().
+  /// @return false if the pixels do not all sit at a fixed stride in a single buffer.
+  bool get_pixel_layout(ESPPixelLayout &layout) const;
 
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
@@ -6,6 +6,8 @@
 
 namespace esphome::light {
 
+class AddressableLight;
+
 class ESPColorSettable {
  public:
   virtual void set(const Color &color) = 0;
@@ -97,6 +99,8 @@ class ESPColorView : public ESPColorSettable {
   }
 
  protected:
+  friend class AddressableLight;
+
   uint8_t *const red_;
   uint8_t *const green_;
   uint8_t *const blue_;
@@ -37,6 +37,7 @@ DOMAIN = "micro_wake_word"
 
 
 CONF_FEATURE_STEP_SIZE = "feature_step_size"
+CONF_GATE_WAKE_WORDS = "gate_wake_words"
 CONF_MODELS = "models"
 CONF_ON_WAKE_WORD_DETECTED = "on_wake_word_detected"
 CONF_PROBABILITY_CUTOFF = "probability_cutoff"
@@ -324,6 +325,7 @@ VAD_MODEL_SCHEMA = MODEL_SCHEMA.extend(
                 CONF_MODEL,
                 default="vad",
             ): MODEL_SOURCE_SCHEMA,
+            cv.Optional(CONF_GATE_WAKE_WORDS, default=False): cv.boolean,
         }
     )
 )
@@ -464,6 +466,7 @@ async def to_code(config):
 
     if vad_model := config.get(CONF_VAD):
         cg.add_define("USE_MICRO_WAKE_WORD_VAD")
+        cg.add(var.set_vad_gate_wake_words(vad_model[CONF_GATE_WAKE_WORDS]))
 
         # Use the general model loading code for the VAD codegen
         config[CONF_MODELS].append(vad_model)
@@ -164,6 +164,7 @@ void MicroWakeWord::inference_task(void *params) {
     }
 
     if (!(xEventGroupGetBits(this_mww->event_group_) & ERROR_BITS)) {
+      this_mww->stagger_model_strides_();
       this_mww->microphone_source_->start();
       xEventGroupSetBits(this_mww->event_group_, EventGroupBits::TASK_RUNNING);
 
@@ -453,17 +454,36 @@ void MicroWakeWord::unload_models_() {
 #endif
 }
 
+void MicroWakeWord::stagger_model_strides_() {
+  uint8_t phase = 0;
+  for (auto &model : this->wake_word_models_) {
+    model->set_stride_phase(phase++);
+  }
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  this->vad_model_->set_stride_phase(phase);
+#endif
+}
+
 bool MicroWakeWord::update_model_probabilities_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]) {
   bool success = true;
+  bool allow_invoke = true;
 
-  for (auto &model : this->wake_word_models_) {
-    // Perform inference
-    success = success & model->perform_streaming_inference(audio_features);
-  }
 #ifdef USE_MICRO_WAKE_WORD_VAD
+  // The VAD model runs first so its newest probability decides whether the wake word models run on this slice
   success = success & this->vad_model_->perform_streaming_inference(audio_features);
+  if (this->vad_gate_wake_words_) {
+    // Any voiced slice in the VAD window opens the gate, so it opens on speech onset and stays open for the window's
+    // length afterwards, rather than waiting for the window's average to cross the cutoff
+    DetectionEvent vad_state = this->vad_model_->determine_detected();
+    allow_invoke = vad_state.detected || (vad_state.max_probability > this->vad_model_->get_probability_cutoff());
+  }
 #endif
 
+  for (auto &model : this->wake_word_models_) {
+    // Perform inference
+    success = success & model->perform_streaming_inference(audio_features, allow_invoke);
+  }
+
   return success;
 }
 
@@ -56,6 +56,9 @@ class MicroWakeWord : public Component {
 
   // Intended for the voice assistant component to fetch VAD status
   bool get_vad_state() { return this->vad_state_; }
+
+  /// If enabled, wake word models skip their inference while the VAD model hears no voice
+  void set_vad_gate_wake_words(bool vad_gate_wake_words) { this->vad_gate_wake_words_ = vad_gate_wake_words; }
 #endif
 
   // Intended for the voice assistant component to access which wake words are available
@@ -73,6 +76,7 @@ class MicroWakeWord : public Component {
 #ifdef USE_MICRO_WAKE_WORD_VAD
   std::unique_ptr<VADModel> vad_model_;
   bool vad_state_{false};
+  bool vad_gate_wake_words_{false};
 #endif
 
   bool pending_start_{false};
@@ -114,6 +118,9 @@ class MicroWakeWord : public Component {
   /// to the detection_queue_.
   void process_probabilities_();
 
+  /// @brief Gives each model a different stride phase so models with equal strides don't all invoke on the same slice
+  void stagger_model_strides_();
+
   /// @brief Deletes each model's TFLite interpreters and frees tensor arena memory.
   void unload_models_();
 
@@ -111,7 +111,7 @@ void StreamingModel::unload_model() {
   this->loaded_ = false;
 }
 
-bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCESSOR_FEATURE_SIZE]) {
+bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCESSOR_FEATURE_SIZE], bool allow_invoke) {
   if (this->enabled_ && !this->loaded_) {
     // Model is enabled but isn't loaded
     if (!this->load_model_()) {
@@ -136,7 +136,13 @@ bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCES
         features, PREPROCESSOR_FEATURE_SIZE);
     ++this->current_stride_step_;
 
-    if (this->current_stride_step_ >= stride) {
+    if ((this->current_stride_step_ >= stride) && !allow_invoke) {
+      // Skipped stride; a zero probability lets the sliding window decay as if the model had heard nothing
+      ++this->last_n_index_;
+      if (this->last_n_index_ == this->sliding_window_size_)
+        this->last_n_index_ = 0;
+      this->recent_streaming_probabilities_[this->last_n_index_] = 0;
+    } else if (this->current_stride_step_ >= stride) {
       TfLiteStatus invoke_status = this->interpreter_->Invoke();
       if (invoke_status != kTfLiteOk) {
         ESP_LOGW(TAG, "Streaming interpreter invoke failed");
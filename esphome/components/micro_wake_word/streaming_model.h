@@ -34,8 +34,14 @@ class StreamingModel {
   // Performs inference on the given features.
   //  - If the model is enabled but not loaded, it will load it
   //  - If the model is disabled but loaded, it will unload it
+  //  - If allow_invoke is false, the features are still added to the input tensor, but a completed stride records a
+  //    zero probability instead of invoking the interpreter
   // Returns true if sucessful or false if there is an error
-  bool perform_streaming_inference(const int8_t features[PREPROCESSOR_FEATURE_SIZE]);
+  bool perform_streaming_inference(const int8_t features[PREPROCESSOR_FEATURE_SIZE], bool allow_invoke = true);
+
+  /// @brief Offsets the model's position within its stride. Models given different phases invoke on different feature
+  /// slices, which spreads the inference cost of several models with the same stride over consecutive slices.
+  void set_stride_phase(uint8_t phase) { this->current_stride_step_ = phase; }
 
   /// @brief Sets all recent_streaming_probabilities to 0 and resets the ignore window count
   void reset_probabilities();
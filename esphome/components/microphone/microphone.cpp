@@ -4,10 +4,17 @@ namespace esphome {
 namespace microphone {
 
 void Microphone::add_data_callback(std::function<void(const std::vector<uint8_t> &)> &&data_callback) {
+  // Callbacks run in registration order, so the first one marks the start of a new chunk
+  const bool first = this->data_callbacks_.size() == 0;
   std::function<void(const std::vector<uint8_t> &)> mute_handled_callback =
-      [this, data_callback](const std::vector<uint8_t> &data) {
+      [this, first, data_callback](const std::vector<uint8_t> &data) {
+        if (first && ++this->chunk_sequence_ == 0)
+          this->chunk_sequence_ = 1;  // 0 marks a conversion buffer without data
         if (this->mute_state_) {
-          data_callback(std::vector<uint8_t>(data.size(), 0));
+          // Reuse one zeroed buffer for all callbacks instead of allocating one per chunk
+          if (this->muted_samples_.size() != data.size())
+            this->muted_samples_.assign(data.size(), 0);
+          data_callback(this->muted_samples_);
         } else {
           data_callback(data);
         };
@@ -15,5 +22,26 @@ void Microphone::add_data_callback(std::function<void(const std::vector<uint8_t>
   this->data_callbacks_.add(std::move(mute_handled_callback));
 }
 
+std::shared_ptr<ConvertedAudio> Microphone::acquire_converted_audio(uint32_t format) {
+  std::shared_ptr<ConvertedAudio> result;
+  for (auto it = this->converted_audio_.begin(); it != this->converted_audio_.end();) {
+    if ((*it)->format == format) {
+      result = *it;
+    } else if (it->use_count() == 1) {
+      // Only referenced by this list, so no source uses this format anymore
+      it = this->converted_audio_.erase(it);
+      continue;
+    }
+    ++it;
+  }
+  if (result == nullptr) {
+    result = std::make_shared<ConvertedAudio>();
+    result->format = format;
+    result->sequence = 0;
+    this->converted_audio_.push_back(result);
+  }
+  return result;
+}
+
 }  // namespace microphone
 }  // namespace esphome
@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <vector>
 #include "esphome/core/helpers.h"
 
@@ -18,6 +19,13 @@ enum State : uint8_t {
   STATE_STOPPING,
 };
 
+/// Audio converted from one microphone chunk, shared by every MicrophoneSource that requests the same format.
+struct ConvertedAudio {
+  uint32_t format;    ///< Format key of the conversion; see MicrophoneSource::format_key_()
+  uint32_t sequence;  ///< Chunk sequence number the data was converted from; 0 if it holds no data yet
+  std::vector<uint8_t> data;
+};
+
 class Microphone {
  public:
   virtual void start() = 0;
@@ -32,6 +40,14 @@ class Microphone {
 
   audio::AudioStreamInfo get_audio_stream_info() { return this->audio_stream_info_; }
 
+  /// @brief Sequence number of the chunk currently being passed to the data callbacks, starting at 1.
+  uint32_t get_chunk_sequence() const { return this->chunk_sequence_; }
+
+  /// @brief Gets the shared conversion buffer for a format, creating it if no source currently uses that format.
+  /// Buffers that are no longer referenced by any source are released. Must only be called from the data callbacks.
+  /// @param format Format key of the requesting source
+  std::shared_ptr<ConvertedAudio> acquire_converted_audio(uint32_t format);
+
  protected:
   State state_{STATE_STOPPED};
   bool mute_state_{false};
@@ -39,6 +55,10 @@ class Microphone {
   audio::AudioStreamInfo audio_stream_info_;
 
   CallbackManager<void(const std::vector<uint8_t> &)> data_callbacks_{};
+
+  std::vector<std::shared_ptr<ConvertedAudio>> converted_audio_;
+  std::vector<uint8_t> muted_samples_;
+  uint32_t chunk_sequence_{0};
 };
 
 }  // namespace microphone
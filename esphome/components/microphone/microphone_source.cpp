@@ -1,24 +1,65 @@
 #include "microphone_source.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace microphone {
 
 static const int32_t Q25_MAX_VALUE = (1 << 25) - 1;
 static const int32_t Q25_MIN_VALUE = ~Q25_MAX_VALUE;
 
+/// Converts 16 or 32 bit samples to 16 bit samples with gain, producing the same result as the generic Q25 path in
+/// process_audio_(). Working directly on typed samples lets the compiler unroll and vectorize the common cases.
+template<typename T>
+static void convert_to_int16(const uint8_t *source, uint8_t *target, uint32_t total_frames, uint32_t source_channels,
+                             std::bitset<8> channels, int32_t gain_factor) {
+  for (uint32_t frame_index = 0; frame_index < total_frames; ++frame_index) {
+    for (uint32_t channel_index = 0; channel_index < source_channels; ++channel_index) {
+      if (!channels.test(channel_index))
+        continue;
+      T raw;
+      memcpy(&raw, source + (frame_index * source_channels + channel_index) * sizeof(T), sizeof(T));
+      int32_t sample = sizeof(T) == 2 ? static_cast<int32_t>(raw) * (1 << 10) : static_cast<int32_t>(raw) >> 6;  // Q25
+      sample = clamp<int32_t>(sample * gain_factor, Q25_MIN_VALUE, Q25_MAX_VALUE);
+      int16_t out = static_cast<int16_t>(sample >> 10);  // Q25 -> Q15
+      memcpy(target, &out, sizeof(out));
+      target += sizeof(out);
+    }
+  }
+}
+
+/// Single channel variant of convert_to_int16(); a flat loop without the channel mask is easy to vectorize.
+template<typename T>
+static void convert_mono_to_int16(const uint8_t *source, uint8_t *target, uint32_t total_frames, int32_t gain_factor) {
+  for (uint32_t i = 0; i < total_frames; ++i) {
+    T raw;
+    memcpy(&raw, source + i * sizeof(T), sizeof(T));
+    int32_t sample = sizeof(T) == 2 ? static_cast<int32_t>(raw) * (1 << 10) : static_cast<int32_t>(raw) >> 6;  // Q25
+    sample = clamp<int32_t>(sample * gain_factor, Q25_MIN_VALUE, Q25_MAX_VALUE);
+    int16_t out = static_cast<int16_t>(sample >> 10);  // Q25 -> Q15
+    memcpy(target + i * sizeof(out), &out, sizeof(out));
+  }
+}
+
 void MicrophoneSource::add_data_callback(std::function<void(const std::vector<uint8_t> &)> &&data_callback) {
   std::function<void(const std::vector<uint8_t> &)> filtered_callback =
       [this, data_callback](const std::vector<uint8_t> &data) {
         if (this->enabled_ || this->passive_) {
-          if (this->processed_samples_.use_count() == 0) {
-            // Create vector if its unused
-            this->processed_samples_ = std::make_shared<std::vector<uint8_t>>();
+          const uint32_t format = this->format_key_();
+          if (this->processed_samples_ == nullptr || this->processed_samples_->format != format) {
+            // Share the buffer of any other source using the same format
+            this->processed_samples_ = this->mic_->acquire_converted_audio(format);
           }
 
           // Take temporary ownership of samples vector to avoid deallaction before the callback finishes
-          std::shared_ptr<std::vector<uint8_t>> output_samples = this->processed_samples_;
-          this->process_audio_(data, *output_samples);
-          data_callback(*output_samples);
+          std::shared_ptr<ConvertedAudio> output_samples = this->processed_samples_;
+          const uint32_t sequence = this->mic_->get_chunk_sequence();
+          if (output_samples->sequence != sequence) {
+            // First source with this format to see the chunk converts it
+            this->process_audio_(data, output_samples->data);
+            output_samples->sequence = sequence;
+          }
+          data_callback(output_samples->data);
         }
       };
   this->mic_->add_data_callback(std::move(filtered_callback));
@@ -29,6 +70,12 @@ audio::AudioStreamInfo MicrophoneSource::get_audio_stream_info() {
                                 this->mic_->get_audio_stream_info().get_sample_rate());
 }
 
+uint32_t MicrophoneSource::format_key_() const {
+  // The gain factor is at most MAX_GAIN_FACTOR, so it fits in the upper 16 bits
+  return static_cast<uint32_t>(this->channels_.to_ulong()) | (this->bits_per_sample_ << 8) |
+         (static_cast<uint32_t>(this->gain_factor_) << 16);
+}
+
 void MicrophoneSource::start() {
   if (!this->enabled_ && !this->passive_) {
     this->enabled_ = true;
@@ -66,6 +113,25 @@ void MicrophoneSource::process_audio_(const std::vector<uint8_t> &data, std::vec
 
   uint8_t *current_data = filtered_data.data();
 
+  if (target_bytes_per_sample == 2 && (source_bytes_per_sample == 2 || source_bytes_per_sample == 4)) {
+    // Fast paths for the usual 16 bit output from 16 or 32 bit microphones
+    const bool mono = source_channels == 1 && this->channels_.test(0);
+    if (source_bytes_per_sample == 2) {
+      if (mono) {
+        convert_mono_to_int16<int16_t>(data.data(), current_data, total_frames, this->gain_factor_);
+      } else {
+        convert_to_int16<int16_t>(data.data(), current_data, total_frames, source_channels, this->channels_,
+                                  this->gain_factor_);
+      }
+    } else if (mono) {
+      convert_mono_to_int16<int32_t>(data.data(), current_data, total_frames, this->gain_factor_);
+    } else {
+      convert_to_int16<int32_t>(data.data(), current_data, total_frames, source_channels, this->channels_,
+                                this->gain_factor_);
+    }
+    return;
+  }
+
   for (uint32_t frame_index = 0; frame_index < total_frames; ++frame_index) {
     for (uint32_t channel_index = 0; channel_index < source_channels; ++channel_index) {
       if (this->channels_.test(channel_index)) {
@@ -29,6 +29,8 @@ class MicrophoneSource {
    *     - Passed through samples have the bits per sample converted
    *     - A gain factor is optionally applied to increase the volume - audio may clip!
    *   - The processed audio is passed to the callback of the component requesting microphone data
+   *   - Sources on the same microphone that request the same format share one converted buffer, so each chunk is
+   *     only converted once no matter how many components consume it
    *   - It tracks an internal enabled state, so it ignores raw microphone data when the component requesting
    *     microphone data is not actively requesting audio.
    *
@@ -66,7 +68,10 @@ class MicrophoneSource {
  protected:
   void process_audio_(const std::vector<uint8_t> &data, std::vector<uint8_t> &filtered_data);
 
-  std::shared_ptr<std::vector<uint8_t>> processed_samples_;
+  /// @brief Key identifying the output format; sources with equal keys produce identical data from the same chunk.
+  uint32_t format_key_() const;
+
+  std::shared_ptr<ConvertedAudio> processed_samples_;
 
   Microphone *mic_;
   uint8_t bits_per_sample_;
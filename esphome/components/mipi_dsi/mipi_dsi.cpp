@@ -1,6 +1,7 @@
 #ifdef USE_ESP32_VARIANT_ESP32P4
 #include <utility>
 #include "mipi_dsi.h"
+#include "esphome/components/display/pixel_ops.h"
 
 namespace esphome {
 namespace mipi_dsi {
@@ -305,17 +306,9 @@ void MIPI_DSI::fill(Color color) {
 
     case display::COLOR_BITNESS_888:
       if (this->color_mode_ == display::COLOR_ORDER_BGR) {
-        for (size_t i = 0; i != this->width_ * this->height_; i++) {
-          this->buffer_[i * 3 + 0] = color.b;
-          this->buffer_[i * 3 + 1] = color.g;
-          this->buffer_[i * 3 + 2] = color.r;
-        }
+        display::pixel_ops::fill_24(this->buffer_, color.b, color.g, color.r, this->width_ * this->height_);
       } else {
-        for (size_t i = 0; i != this->width_ * this->height_; i++) {
-          this->buffer_[i * 3 + 0] = color.r;
-          this->buffer_[i * 3 + 1] = color.g;
-          this->buffer_[i * 3 + 2] = color.b;
-        }
+        display::pixel_ops::fill_24(this->buffer_, color.r, color.g, color.b, this->width_ * this->height_);
       }
 
     default:
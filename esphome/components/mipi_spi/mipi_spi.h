@@ -1,10 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <bitset>
+#include <cinttypes>
 #include <utility>
 
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display.h"
 #include "esphome/components/display/display_color_utils.h"
+#include "esphome/components/display/pixel_ops.h"
 
 namespace esphome {
 namespace mipi_spi {
@@ -369,47 +373,35 @@ class MipiSpi : public display::Display,
                                 x_pad * sizeof(BUFFERTYPE));
     } else {
       // type conversion required, do it in chunks
-      uint8_t dbuffer[DISPLAYPIXEL * 48];
-      uint8_t *dptr = dbuffer;
+      static constexpr size_t CHUNK_PIXELS = 48;
+      uint8_t dbuffer[DISPLAYPIXEL * CHUNK_PIXELS];
+      size_t used = 0;                     // pixels already converted into dbuffer
       auto stride = x_offset + w + x_pad;  // stride in pixels
       for (size_t y = 0; y != static_cast<size_t>(h); y++) {
-        for (size_t x = 0; x != static_cast<size_t>(w); x++) {
-          auto color_val = ptr[y * stride + x];
+        const BUFFERTYPE *row = ptr + y * stride;
+        size_t x = 0;
+        while (x != static_cast<size_t>(w)) {
+          const size_t count = std::min(static_cast<size_t>(w) - x, CHUNK_PIXELS - used);
+          uint8_t *dptr = dbuffer + used * DISPLAYPIXEL;
           if constexpr (DISPLAYPIXEL == PIXEL_MODE_18 && BUFFERPIXEL == PIXEL_MODE_16) {
-            // 16 to 18 bit conversion
-            if constexpr (IS_BIG_ENDIAN) {
-              *dptr++ = color_val & 0xF8;
-              *dptr++ = ((color_val & 0x7) << 5) | (color_val & 0xE000) >> 11;
-              *dptr++ = (color_val >> 5) & 0xF8;
-            } else {
-              *dptr++ = (color_val >> 8) & 0xF8;  // Blue
-              *dptr++ = (color_val & 0x7E0) >> 3;
-              *dptr++ = color_val << 3;
-            }
+            display::pixel_ops::rgb565_to_rgb666(dptr, row + x, count, IS_BIG_ENDIAN);
           } else if constexpr (DISPLAYPIXEL == PIXEL_MODE_18 && BUFFERPIXEL == PIXEL_MODE_8) {
-            // 8 bit to 18 bit conversion
-            *dptr++ = color_val << 6;           // Blue
-            *dptr++ = (color_val & 0x1C) << 3;  // Green
-            *dptr++ = (color_val & 0xE0);       // Red
+            display::pixel_ops::rgb332_to_bgr666(dptr, row + x, count);
           } else if constexpr (DISPLAYPIXEL == PIXEL_MODE_16 && BUFFERPIXEL == PIXEL_MODE_8) {
-            if constexpr (IS_BIG_ENDIAN) {
-              *dptr++ = (color_val & 0xE0) | ((color_val & 0x1C) >> 2);
-              *dptr++ = (color_val & 3) << 3;
-            } else {
-              *dptr++ = (color_val & 3) << 3;
-              *dptr++ = (color_val & 0xE0) | ((color_val & 0x1C) >> 2);
-            }
+            display::pixel_ops::rgb332_to_rgb565(dptr, row + x, count, IS_BIG_ENDIAN);
           }
+          x += count;
+          used += count;
           // buffer full? Flush.
-          if (dptr == dbuffer + sizeof(dbuffer)) {
+          if (used == CHUNK_PIXELS) {
             this->write_display_data_(dbuffer, sizeof(dbuffer), 1, 0);
-            dptr = dbuffer;
+            used = 0;
           }
         }
       }
       // flush any remaining data
-      if (dptr != dbuffer) {
-        this->write_display_data_(dbuffer, dptr - dbuffer, 1, 0);
+      if (used != 0) {
+        this->write_display_data_(dbuffer, used * DISPLAYPIXEL, 1, 0);
       }
     }
     this->disable();
@@ -456,6 +448,25 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
   // ignore the extra columns and rows when drawing, but use them to write to the display.
   static constexpr unsigned BUFFER_WIDTH = (WIDTH + ROUNDING - 1) / ROUNDING * ROUNDING;
   static constexpr unsigned BUFFER_HEIGHT = (HEIGHT + ROUNDING - 1) / ROUNDING * ROUNDING;
+  // Changes are tracked per tile of TILE_SIZE x TILE_SIZE native pixels
+  static constexpr int TILE_SIZE = 16;
+  static constexpr unsigned TILE_COLS = (WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+  static constexpr unsigned TILE_ROWS = (HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
+  // Maximum number of rectangles sent per buffer window before falling back to a single bounding box
+  static constexpr size_t MAX_DIRTY_RECTS = 8;
+
+  // Frame statistics are logged and restarted at this interval
+  static constexpr uint32_t STATS_INTERVAL_MS = 60000;
+
+  // Frame timing counters for the current interval, all times in microseconds
+  struct FrameStats {
+    uint32_t frames;
+    uint32_t draw_us;
+    uint32_t flush_us;
+    uint32_t max_frame_us;
+    uint32_t bytes;
+    uint32_t rects;
+  };
 
   MipiSpiBuffer() { this->rotation_ = ROTATION; }
 
@@ -472,6 +483,12 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
                     sizeof(BUFFERTYPE) * BUFFER_WIDTH * BUFFER_HEIGHT / FRACTION, ROUNDING);
   }
 
+  const FrameStats &get_frame_stats() const { return this->stats_; }
+  void reset_frame_stats() {
+    this->stats_ = {};
+    this->stats_start_ = millis();
+  }
+
   void setup() override {
     MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DISPLAYPIXEL, BUS_TYPE, WIDTH, HEIGHT, OFFSET_WIDTH,
             OFFSET_HEIGHT>::setup();
@@ -483,18 +500,14 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
   }
 
   void update() override {
-#if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
-    auto now = millis();
-#endif
     if (this->is_failed()) {
       return;
     }
+    const uint32_t frame_start = micros();
+    uint32_t flush_us = 0;
     // for updates with a small buffer, we repeatedly call the writer_ function, clipping the height to a fraction of
     // the display height,
     for (this->start_line_ = 0; this->start_line_ < HEIGHT; this->start_line_ += HEIGHT / FRACTION) {
-#if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
-      auto lap = millis();
-#endif
       this->end_line_ = this->start_line_ + HEIGHT / FRACTION;
       if (this->auto_clear_enabled_) {
         this->clear();
@@ -506,36 +519,41 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
       } else {
         this->test_card();
       }
-#if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
-      esph_log_v(TAG, "Drawing from line %d took %dms", this->start_line_, millis() - lap);
-      lap = millis();
-#endif
-      if (this->x_low_ > this->x_high_ || this->y_low_ > this->y_high_)
-        return;
-      esph_log_v(TAG, "x_low %d, y_low %d, x_high %d, y_high %d", this->x_low_, this->y_low_, this->x_high_,
-                 this->y_high_);
-      // Some chips require that the drawing window be aligned on certain boundaries
-      this->x_low_ = this->x_low_ / ROUNDING * ROUNDING;
-      this->y_low_ = this->y_low_ / ROUNDING * ROUNDING;
-      this->x_high_ = (this->x_high_ + ROUNDING) / ROUNDING * ROUNDING - 1;
-      this->y_high_ = (this->y_high_ + ROUNDING) / ROUNDING * ROUNDING - 1;
-      int w = this->x_high_ - this->x_low_ + 1;
-      int h = this->y_high_ - this->y_low_ + 1;
-      this->write_to_display_(this->x_low_, this->y_low_, w, h, this->buffer_, this->x_low_,
-                              this->y_low_ - this->start_line_, BUFFER_WIDTH - w);
-      // invalidate watermarks
-      this->x_low_ = WIDTH;
-      this->y_low_ = HEIGHT;
-      this->x_high_ = 0;
-      this->y_high_ = 0;
-#if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
-      esph_log_v(TAG, "Write to display took %dms", millis() - lap);
-      lap = millis();
-#endif
+      const uint32_t lap = micros();
+      DirtyRect rects[MAX_DIRTY_RECTS];
+      size_t count = this->collect_dirty_rects_(rects);
+      for (size_t i = 0; i != count; i++) {
+        // Convert the tile rectangle to pixels, clipped to the display and the buffer window
+        int x_low = rects[i].x1 * TILE_SIZE;
+        int y_low = std::max<int>(rects[i].y1 * TILE_SIZE, this->start_line_);
+        int x_high = std::min<int>((rects[i].x2 + 1) * TILE_SIZE, WIDTH) - 1;
+        int y_high = std::min<int>((rects[i].y2 + 1) * TILE_SIZE, this->end_line_) - 1;
+        if (y_low > y_high)
+          continue;
+        // Some chips require that the drawing window be aligned on certain boundaries
+        x_low = x_low / ROUNDING * ROUNDING;
+        y_low = y_low / ROUNDING * ROUNDING;
+        x_high = (x_high + ROUNDING) / ROUNDING * ROUNDING - 1;
+        y_high = (y_high + ROUNDING) / ROUNDING * ROUNDING - 1;
+        esph_log_v(TAG, "x_low %d, y_low %d, x_high %d, y_high %d", x_low, y_low, x_high, y_high);
+        int w = x_high - x_low + 1;
+        int h = y_high - y_low + 1;
+        this->write_to_display_(x_low, y_low, w, h, this->buffer_, x_low, y_low - this->start_line_, BUFFER_WIDTH - w);
+        this->stats_.bytes += w * h * DISPLAYPIXEL;
+      }
+      this->stats_.rects += count;
+      flush_us += micros() - lap;
+    }
+    const uint32_t frame_us = micros() - frame_start;
+    this->stats_.frames++;
+    this->stats_.flush_us += flush_us;
+    this->stats_.draw_us += frame_us - flush_us;
+    this->stats_.max_frame_us = std::max(this->stats_.max_frame_us, frame_us);
+    esph_log_v(TAG, "Update took %" PRIu32 "us, flush %" PRIu32 "us", frame_us, flush_us);
+    if (millis() - this->stats_start_ >= STATS_INTERVAL_MS) {
+      this->log_frame_stats_();
+      this->reset_frame_stats();
     }
-#if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
-    esph_log_v(TAG, "Total update took %dms", millis() - now);
-#endif
   }
 
   // Draw a pixel at the given coordinates.
@@ -546,29 +564,49 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
     if (x < 0 || x >= WIDTH || y < this->start_line_ || y >= this->end_line_)
       return;
     this->buffer_[(y - this->start_line_) * BUFFER_WIDTH + x] = convert_color(color);
-    if (x < this->x_low_) {
-      this->x_low_ = x;
-    }
-    if (x > this->x_high_) {
-      this->x_high_ = x;
-    }
-    if (y < this->y_low_) {
-      this->y_low_ = y;
-    }
-    if (y > this->y_high_) {
-      this->y_high_ = y;
-    }
+    this->dirty_tiles_[y / TILE_SIZE].set(x / TILE_SIZE);
   }
 
   // Fills the display with a color.
   void fill(Color color) override {
-    this->x_low_ = 0;
-    this->y_low_ = this->start_line_;
-    this->x_high_ = WIDTH - 1;
-    this->y_high_ = this->end_line_ - 1;
+    this->mark_dirty_(0, this->start_line_, WIDTH - 1, this->end_line_ - 1);
     std::fill_n(this->buffer_, HEIGHT * BUFFER_WIDTH / FRACTION, convert_color(color));
   }
 
+  // Fill a horizontal run; the color is converted and the dirty bounds are updated once per run.
+  void fill_run(int x, int y, int width, Color color) override {
+    int skip;
+    if (!this->clip_run_(x, y, width, skip))
+      return;
+    const BUFFERTYPE value = convert_color(color);
+    this->write_run_(x, y, width, [value](BUFFERTYPE &pixel, int) { pixel = value; });
+  }
+
+  // Blend a horizontal run through a coverage mask; fully covered pixels reuse the pre-converted color.
+  void blend_run(int x, int y, int width, const uint8_t *alpha, Color color, Color background) override {
+    int skip;
+    if (!this->clip_run_(x, y, width, skip))
+      return;
+    alpha += skip;
+    if constexpr (ROTATION == display::DISPLAY_ROTATION_0_DEGREES && BUFFERPIXEL == PIXEL_MODE_16) {
+      // The run is contiguous in the buffer, so blend it in one pass
+      if (y < this->start_line_ || y >= this->end_line_)
+        return;
+      display::pixel_ops::blend_rgb565(this->buffer_ + (y - this->start_line_) * BUFFER_WIDTH + x, alpha, color,
+                                       background, width, IS_BIG_ENDIAN);
+      this->mark_dirty_(x, y, x + width - 1, y);
+      return;
+    }
+    const BUFFERTYPE value = convert_color(color);
+    this->write_run_(x, y, width, [alpha, value, color, background](BUFFERTYPE &pixel, int i) {
+      if (alpha[i] == 255) {
+        pixel = value;
+      } else if (alpha[i] != 0) {
+        pixel = convert_color(display::blend_color(color, background, alpha[i]));
+      }
+    });
+  }
+
   int get_width() override {
     if constexpr (ROTATION == display::DISPLAY_ROTATION_90_DEGREES || ROTATION == display::DISPLAY_ROTATION_270_DEGREES)
       return HEIGHT;
@@ -598,25 +636,136 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
     }
   }
 
+  /**
+   * Apply op to each buffer pixel of a run that has already been clipped in user coordinates.
+   * The run is walked in native coordinates, so with 90 or 270 degree rotation it becomes a column in the buffer.
+   * Pixels outside the current buffer window (start_line_ to end_line_) are skipped.
+   */
+  template<typename F> void write_run_(int x, int y, int width, F &&op) {
+    // Step between two consecutive pixels of the run in native coordinates
+    constexpr int STEP_X = ROTATION == display::DISPLAY_ROTATION_0_DEGREES     ? 1
+                           : ROTATION == display::DISPLAY_ROTATION_180_DEGREES ? -1
+                                                                                : 0;
+    constexpr int STEP_Y = ROTATION == display::DISPLAY_ROTATION_90_DEGREES    ? 1
+                           : ROTATION == display::DISPLAY_ROTATION_270_DEGREES ? -1
+                                                                                : 0;
+    rotate_coordinates(x, y);
+    // Range of run indices that fall inside the buffer window
+    int first = 0;
+    int last = width;
+    if constexpr (STEP_Y == 0) {
+      if (y < this->start_line_ || y >= this->end_line_)
+        return;
+    } else if constexpr (STEP_Y > 0) {
+      first = std::max(0, this->start_line_ - y);
+      last = std::min(width, this->end_line_ - y);
+    } else {
+      first = std::max(0, y - this->end_line_ + 1);
+      last = std::min(width, y - this->start_line_ + 1);
+    }
+    if (first >= last)
+      return;
+    const int x1 = x + first * STEP_X;
+    const int y1 = y + first * STEP_Y;
+    BUFFERTYPE *ptr = this->buffer_ + (y1 - this->start_line_) * static_cast<int>(BUFFER_WIDTH) + x1;
+    for (int i = first; i != last; i++, ptr += STEP_X + STEP_Y * static_cast<int>(BUFFER_WIDTH))
+      op(*ptr, i);
+    const int x2 = x + (last - 1) * STEP_X;
+    const int y2 = y + (last - 1) * STEP_Y;
+    this->mark_dirty_(std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2));
+  }
+
+  // A rectangle of dirty tiles, inclusive tile coordinates
+  struct DirtyRect {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+  };
+
+  // Mark the tiles covering the given native pixel rectangle (inclusive) as changed.
+  void mark_dirty_(int x1, int y1, int x2, int y2) {
+    for (int ty = y1 / TILE_SIZE; ty <= y2 / TILE_SIZE; ty++) {
+      for (int tx = x1 / TILE_SIZE; tx <= x2 / TILE_SIZE; tx++)
+        this->dirty_tiles_[ty].set(tx);
+    }
+  }
+
+  /**
+   * Merge the dirty tiles of the current buffer window into at most MAX_DIRTY_RECTS rectangles and clear them.
+   * Each tile row is split into runs of dirty tiles, and a run extends a rectangle from the row above when it spans
+   * the same columns. If more rectangles would be needed, a single bounding box is returned instead.
+   * @return The number of rectangles written to rects
+   */
+  size_t collect_dirty_rects_(DirtyRect *rects) {
+    size_t count = 0;
+    bool overflow = false;
+    DirtyRect bounds{TILE_COLS, TILE_ROWS, 0, 0};
+    const unsigned last_row = std::min<unsigned>((this->end_line_ - 1) / TILE_SIZE, TILE_ROWS - 1);
+    for (unsigned row = this->start_line_ / TILE_SIZE; row <= last_row; row++) {
+      auto &tiles = this->dirty_tiles_[row];
+      if (tiles.none())
+        continue;
+      unsigned col = 0;
+      while (col != TILE_COLS) {
+        if (!tiles.test(col)) {
+          col++;
+          continue;
+        }
+        const unsigned start = col;
+        while (col != TILE_COLS && tiles.test(col))
+          col++;
+        const unsigned end = col - 1;
+        bounds.x1 = std::min<unsigned>(bounds.x1, start);
+        bounds.y1 = std::min<unsigned>(bounds.y1, row);
+        bounds.x2 = std::max<unsigned>(bounds.x2, end);
+        bounds.y2 = std::max<unsigned>(bounds.y2, row);
+        if (overflow)
+          continue;
+        auto *rect = std::find_if(rects, rects + count, [row, start, end](const DirtyRect &r) {
+          return r.y2 + 1u == row && r.x1 == start && r.x2 == end;
+        });
+        if (rect != rects + count) {
+          rect->y2 = row;
+        } else if (count == MAX_DIRTY_RECTS) {
+          overflow = true;
+        } else {
+          rects[count++] = {static_cast<uint16_t>(start), static_cast<uint16_t>(row), static_cast<uint16_t>(end),
+                            static_cast<uint16_t>(row)};
+        }
+      }
+      tiles.reset();
+    }
+    if (overflow) {
+      rects[0] = bounds;
+      count = 1;
+    }
+    return count;
+  }
+
   // Convert a color to the buffer pixel format.
   static BUFFERTYPE convert_color(const Color &color) {
     if constexpr (BUFFERPIXEL == PIXEL_MODE_8) {
       return (color.red & 0xE0) | (color.g & 0xE0) >> 3 | color.b >> 6;
     } else if constexpr (BUFFERPIXEL == PIXEL_MODE_16) {
-      if constexpr (IS_BIG_ENDIAN) {
-        return (color.r & 0xF8) | color.g >> 5 | (color.g & 0x1C) << 11 | (color.b & 0xF8) << 5;
-      } else {
-        return (color.r & 0xF8) << 8 | (color.g & 0xFC) << 3 | color.b >> 3;
-      }
+      return display::pixel_ops::color_to_rgb565(color, IS_BIG_ENDIAN);
     }
     return static_cast<BUFFERTYPE>(0);
   }
 
+  void log_frame_stats_() {
+    esph_log_d(TAG,
+               "%" PRIu32 " frames in %" PRIu32 "s: average draw %" PRIu32 "us, average flush %" PRIu32
+               "us, max frame %" PRIu32 "us, %" PRIu32 " bytes and %" PRIu32 " rectangles per frame",
+               this->stats_.frames, (millis() - this->stats_start_) / 1000, this->stats_.draw_us / this->stats_.frames,
+               this->stats_.flush_us / this->stats_.frames, this->stats_.max_frame_us,
+               this->stats_.bytes / this->stats_.frames, this->stats_.rects / this->stats_.frames);
+  }
+
   BUFFERTYPE *buffer_{};
-  uint16_t x_low_{WIDTH};
-  uint16_t y_low_{HEIGHT};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
+  std::bitset<TILE_COLS> dirty_tiles_[TILE_ROWS]{};
+  FrameStats stats_{};
+  uint32_t stats_start_{0};
   uint16_t start_line_{0};
   uint16_t end_line_{1};
 };
@@ -451,6 +451,12 @@ void MixerSpeaker::mix_audio_samples(const int16_t *primary_buffer, audio::Audio
   const uint8_t secondary_channels = secondary_stream_info.get_channels();
   const uint8_t output_channels = output_stream_info.get_channels();
 
+  if ((primary_channels == output_channels) && (secondary_channels == output_channels)) {
+    // Sample layouts match, so the frames can be summed as one contiguous block
+    audio::add_audio_samples(primary_buffer, secondary_buffer, output_buffer, frames_to_mix * output_channels);
+    return;
+  }
+
   const uint8_t max_primary_channel_index = primary_channels - 1;
   const uint8_t max_secondary_channel_index = secondary_channels - 1;
 
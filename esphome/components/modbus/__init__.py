@@ -50,6 +50,8 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     await uart.register_uart_device(var, config)
+    # Wake the loop as soon as a reply arrives instead of waiting for the next loop interval
+    uart.request_wake_loop_on_rx()
 
     cg.add(var.set_role(config[CONF_ROLE]))
     if CONF_FLOW_CONTROL_PIN in config:
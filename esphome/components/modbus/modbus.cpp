@@ -8,29 +8,52 @@ namespace modbus {
 
 static const char *const TAG = "modbus";
 
+// Bytes drained from the UART per bulk read; a full RTU frame is at most 256 bytes
+static const size_t MODBUS_READ_BUFFER_SIZE = 64;
+
+// Longest turnaround wait done inline before sending; longer ones are left to the next loop
+static const uint32_t MAX_INLINE_FRAME_DELAY_US = 2000;
+// Shortest silence before a partial frame is discarded, as UARTs may hand over received bytes late
+static const uint32_t MIN_FRAME_TIMEOUT_MS = 10;
+
 void Modbus::setup() {
   if (this->flow_control_pin_ != nullptr) {
     this->flow_control_pin_->setup();
   }
+
+  // A character is a start bit, the data bits, an optional parity bit and the stop bits
+  const uint32_t baud_rate = std::max<uint32_t>(this->parent_->get_baud_rate(), 1);
+  uint32_t char_bits = 1 + this->parent_->get_data_bits() + this->parent_->get_stop_bits();
+  if (this->parent_->get_parity() != uart::UART_CONFIG_PARITY_NONE)
+    char_bits++;
+  const uint32_t char_us = char_bits * 1000000 / baud_rate;
+  // Above 19200 baud the Modbus RTU specification fixes the inter-frame delay at 1.75 ms
+  this->frame_delay_us_ = baud_rate > 19200 ? 1750 : char_us * 7 / 2;
+  // Received bytes can wait in the UART FIFO until its full threshold or RX timeout fires, so allow for those too
+  const uint32_t held_us = (this->parent_->get_rx_full_threshold() + this->parent_->get_rx_timeout()) * char_us;
+  this->frame_timeout_ms_ = std::max((this->frame_delay_us_ + held_us + 999) / 1000, MIN_FRAME_TIMEOUT_MS);
 }
 void Modbus::loop() {
   const uint32_t now = App.get_loop_component_start_time();
 
-  while (this->available()) {
-    uint8_t byte;
-    this->read_byte(&byte);
-    if (this->parse_modbus_byte_(byte)) {
-      this->last_modbus_byte_ = now;
-    } else {
-      size_t at = this->rx_buffer_.size();
-      if (at > 0) {
-        ESP_LOGV(TAG, "Clearing buffer of %d bytes - parse failed", at);
-        this->rx_buffer_.clear();
+  uint8_t buffer[MODBUS_READ_BUFFER_SIZE];
+  size_t len;
+  while ((len = this->read_available(buffer)) > 0) {
+    this->last_modbus_byte_us_ = micros();
+    for (size_t i = 0; i < len; i++) {
+      if (this->parse_modbus_byte_(buffer[i])) {
+        this->last_modbus_byte_ = now;
+      } else {
+        size_t at = this->rx_buffer_.size();
+        if (at > 0) {
+          ESP_LOGV(TAG, "Clearing buffer of %d bytes - parse failed", at);
+          this->rx_buffer_.clear();
+        }
       }
     }
   }
 
-  if (now - this->last_modbus_byte_ > 50) {
+  if (now - this->last_modbus_byte_ > this->frame_timeout_ms_) {
     size_t at = this->rx_buffer_.size();
     if (at > 0) {
       ESP_LOGV(TAG, "Clearing buffer of %d bytes - timeout", at);
@@ -45,6 +68,31 @@ void Modbus::loop() {
       waiting_for_response = 0;
     }
   }
+
+  this->send_next_request_();
+}
+
+void Modbus::send_next_request_() {
+  if (this->role != ModbusRole::CLIENT || this->waiting_for_response != 0 || !this->rx_buffer_.empty() ||
+      this->devices_.empty())
+    return;
+
+  // Keep the inter-frame silence after the last byte seen on the bus
+  const uint32_t silence_us = micros() - this->last_modbus_byte_us_;
+  if (silence_us < this->frame_delay_us_) {
+    if (this->frame_delay_us_ - silence_us > MAX_INLINE_FRAME_DELAY_US)
+      return;
+    delayMicroseconds(this->frame_delay_us_ - silence_us);
+  }
+
+  const size_t count = this->devices_.size();
+  for (size_t i = 0; i < count; i++) {
+    size_t index = (this->next_device_ + i) % count;
+    if (this->devices_[index]->on_bus_idle()) {
+      this->next_device_ = (index + 1) % count;
+      return;
+    }
+  }
 }
 
 bool Modbus::parse_modbus_byte_(uint8_t byte) {
@@ -147,7 +195,8 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
       }
     }
   }
-  std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
+  // The data is handed to the devices in place; it stays valid until the buffer is cleared below
+  std::span<const uint8_t> data(raw + data_offset, data_len);
   bool found = false;
   for (auto *device : this->devices_) {
     if (device->address_ == address) {
@@ -172,12 +221,12 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
         }
         if (function_code == ModbusFunctionCode::WRITE_SINGLE_REGISTER ||
             function_code == ModbusFunctionCode::WRITE_MULTIPLE_REGISTERS) {
-          device->on_modbus_write_registers(function_code, data);
+          device->on_modbus_write_registers(function_code, std::vector<uint8_t>(data.begin(), data.end()));
           continue;
         }
       }
       // fallthrough for other function codes
-      device->on_modbus_data(data);
+      device->on_modbus_frame(data);
     }
   }
   waiting_for_response = 0;
@@ -253,6 +302,7 @@ void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address
 
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(false);
+  this->last_modbus_byte_us_ = micros();
   waiting_for_response = address;
   last_send_ = millis();
   ESP_LOGV(TAG, "Modbus write: %s", format_hex_pretty(data).c_str());
@@ -275,6 +325,7 @@ void Modbus::send_raw(const std::vector<uint8_t> &payload) {
   this->flush();
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(false);
+  this->last_modbus_byte_us_ = micros();
   waiting_for_response = payload[0];
   ESP_LOGV(TAG, "Modbus write raw: %s", format_hex_pretty(payload).c_str());
   last_send_ = millis();
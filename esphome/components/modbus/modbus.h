@@ -5,6 +5,7 @@
 
 #include "esphome/components/modbus/modbus_definitions.h"
 
+#include <span>
 #include <vector>
 
 namespace esphome {
@@ -46,12 +47,21 @@ class Modbus : public uart::UARTDevice, public Component {
   GPIOPin *flow_control_pin_{nullptr};
 
   bool parse_modbus_byte_(uint8_t byte);
+  /// Offers the bus to the devices in round-robin order once no response is pending and the inter-frame silence has
+  /// passed, so requests to different devices are interleaved back to back
+  void send_next_request_();
   uint16_t send_wait_time_{250};
   bool disable_crc_;
   std::vector<uint8_t> rx_buffer_;
   uint32_t last_modbus_byte_{0};
+  uint32_t last_modbus_byte_us_{0};
   uint32_t last_send_{0};
+  /// Silence of 3.5 characters that separates frames, in microseconds
+  uint32_t frame_delay_us_{1750};
+  /// Silence after which a partially received frame is discarded, in milliseconds
+  uint32_t frame_timeout_ms_{50};
   std::vector<ModbusDevice *> devices_;
+  size_t next_device_{0};
 };
 
 class ModbusDevice {
@@ -59,6 +69,14 @@ class ModbusDevice {
   void set_parent(Modbus *parent) { parent_ = parent; }
   void set_address(uint8_t address) { address_ = address; }
   virtual void on_modbus_data(const std::vector<uint8_t> &data) = 0;
+  /// Called with the data bytes of a reply, viewed in place in the bus receive buffer and only valid during the call.
+  /// The default copies them for on_modbus_data(); devices that can consume the view directly should override this.
+  virtual void on_modbus_frame(std::span<const uint8_t> data) {
+    this->on_modbus_data(std::vector<uint8_t>(data.begin(), data.end()));
+  }
+  /// Called by a client bus in round-robin order whenever no response is pending. Send at most one request and return
+  /// true if one was sent, so the bus moves on to the next device.
+  virtual bool on_bus_idle() { return false; }
   virtual void on_modbus_error(uint8_t function_code, uint8_t exception_code) {}
   virtual void on_modbus_read_registers(uint8_t function_code, uint16_t start_address, uint16_t number_of_registers){};
   virtual void on_modbus_write_registers(uint8_t function_code, const std::vector<uint8_t> &data){};
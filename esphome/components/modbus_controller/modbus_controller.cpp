@@ -13,10 +13,13 @@ void ModbusController::setup() { this->create_register_ranges_(); }
  To work with the existing modbus class and avoid polling for responses a command queue is used.
  send_next_command will submit the command at the top of the queue and set the corresponding callback
  to handle the response from the device.
- Once the response has been processed it is removed from the queue and the next command is sent
+ Once the response has been processed it is removed from the queue and the next command is sent.
+ The modbus bus calls it whenever it is idle, taking turns with the other devices on the bus.
+ Returns true if a command was put on the bus.
 */
 bool ModbusController::send_next_command_() {
   uint32_t last_send = millis() - this->last_command_timestamp_;
+  bool sent = false;
 
   if ((last_send > this->command_throttle_) && !waiting_for_response() && !this->command_queue_.empty()) {
     auto &command = this->command_queue_.front();
@@ -43,6 +46,7 @@ bool ModbusController::send_next_command_() {
       ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
                command->register_address, command->register_count);
       command->send();
+      sent = true;
 
       this->last_command_timestamp_ = millis();
 
@@ -54,11 +58,15 @@ bool ModbusController::send_next_command_() {
       }
     }
   }
-  return (!this->command_queue_.empty());
+  return sent;
 }
 
-// Queue incoming response
 void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
+  this->on_modbus_frame(std::span<const uint8_t>(data.data(), data.size()));
+}
+
+// Queue incoming response
+void ModbusController::on_modbus_frame(std::span<const uint8_t> data) {
   auto &current_command = this->command_queue_.front();
   if (current_command != nullptr) {
     if (this->module_offline_) {
@@ -76,7 +84,7 @@ void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
     }
 
     // Move the commandItem to the response queue
-    current_command->payload = data;
+    current_command->payload.assign(data.begin(), data.end());
     this->incoming_queue_.push(std::move(current_command));
     ESP_LOGV(TAG, "Modbus response queued");
     this->command_queue_.pop_front();
@@ -337,6 +345,20 @@ void ModbusController::update() {
   }
 }
 
+// A register that starts a few registers after the end of the current range can be merged into it by also reading
+// the unused registers in between, which saves a whole request and response turnaround on the bus
+bool ModbusController::can_bridge_gap_(const RegisterRange &r, uint8_t buffer_offset, const SensorItem *curr) const {
+  const uint16_t end = r.start_address + r.register_count;
+  if (this->max_register_gap_ == 0 || curr->start_address <= end || curr->start_address - end > this->max_register_gap_)
+    return false;
+  // Only register reads have a buffer layout where the skipped registers take two bytes each
+  if (curr->register_type != ModbusRegisterType::HOLDING && curr->register_type != ModbusRegisterType::READ)
+    return false;
+  if (buffer_offset != r.register_count * 2 || curr->get_register_size() != curr->register_count * 2)
+    return false;
+  return curr->start_address + curr->register_count - r.start_address <= modbus::MAX_NUM_OF_REGISTERS_TO_READ;
+}
+
 // walk through the sensors and determine the register ranges to read
 size_t ModbusController::create_register_ranges_() {
   this->register_ranges_.clear();
@@ -388,8 +410,12 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
-        } else if (curr->start_address == (r.start_address + r.register_count)) {
-          // this register can extend the current range
+        } else if (curr->start_address == (r.start_address + r.register_count) ||
+                   this->can_bridge_gap_(r, buffer_offset, curr)) {
+          // this register can extend the current range, possibly after reading over a few unused registers
+          uint16_t gap = curr->start_address - (r.start_address + r.register_count);
+          buffer_offset += gap * 2;
+          r.register_count += gap;
 
           // remove this sensore because start_address is changed (sort-order)
           ix = this->sensorset_.erase(ix);
@@ -479,19 +505,22 @@ void ModbusController::dump_config() {
 }
 
 void ModbusController::loop() {
-  // Incoming data to process?
+  // Incoming data to process? Pending commands are sent when the bus offers this device a turn, see on_bus_idle()
   if (!this->incoming_queue_.empty()) {
     auto &message = this->incoming_queue_.front();
     if (message != nullptr)
       this->process_modbus_data_(message.get());
     this->incoming_queue_.pop();
-
-  } else {
-    // all messages processed send pending commands
-    this->send_next_command_();
   }
 }
 
+bool ModbusController::on_bus_idle() {
+  // Responses are handled first so that a command queued from a response handler goes out in order
+  if (!this->incoming_queue_.empty())
+    return false;
+  return this->send_next_command_();
+}
+
 void ModbusController::on_write_register_response(ModbusRegisterType register_type, uint16_t start_address,
                                                   const std::vector<uint8_t> &data) {
   ESP_LOGV(TAG, "Command ACK 0x%X %d ", get_data<uint16_t>(data, 0), get_data<int16_t>(data, 1));
@@ -474,6 +474,10 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void add_server_register(ServerRegister *server_register) { server_registers_.push_back(server_register); }
   /// called when a modbus response was parsed without errors
   void on_modbus_data(const std::vector<uint8_t> &data) override;
+  /// called with the response data viewed in place in the bus receive buffer
+  void on_modbus_frame(std::span<const uint8_t> data) override;
+  /// called by the modbus bus when it is this device's turn to send
+  bool on_bus_idle() override;
   /// called when a modbus error response was received
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
   /// called when a modbus request (function code 0x03 or 0x04) was parsed without errors
@@ -494,6 +498,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   bool get_allow_duplicate_commands() { return this->allow_duplicate_commands_; }
   /// called by esphome generated code to set the command_throttle period
   void set_command_throttle(uint16_t command_throttle) { this->command_throttle_ = command_throttle; }
+  /// called by esphome generated code to set how many unused registers may be read to merge two ranges
+  void set_max_register_gap(uint16_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
   /// called by esphome generated code to set the offline_skip_updates
   void set_offline_skip_updates(uint16_t offline_skip_updates) { this->offline_skip_updates_ = offline_skip_updates; }
   /// get the number of queued modbus commands (should be mostly empty)
@@ -520,6 +526,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
  protected:
   /// parse sensormap_ and create range of sequential addresses
   size_t create_register_ranges_();
+  /// check if curr can be appended to range r by also reading the unused registers in between
+  bool can_bridge_gap_(const RegisterRange &r, uint8_t buffer_offset, const SensorItem *curr) const;
   // find register in sensormap. Returns iterator with all registers having the same start address
   SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
   /// submit the read command for the address range to the send queue
@@ -546,6 +554,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   uint32_t last_command_timestamp_{0};
   /// min time in ms between sending modbus commands
   uint16_t command_throttle_{0};
+  /// max number of unused registers read to merge two register ranges
+  uint16_t max_register_gap_{0};
   /// if module didn't respond the last command
   bool module_offline_{false};
   /// how many updates to skip if module is offline
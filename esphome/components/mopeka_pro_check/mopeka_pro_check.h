@@ -32,6 +32,9 @@ class MopekaProCheck : public Component, public esp32_ble_tracker::ESPBTDeviceLi
  public:
   void set_address(uint64_t address) { address_ = address; };
 
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override {
+    return advertisement.address_uint64() == this->address_;
+  }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   void dump_config() override;
   void set_min_signal_quality(SensorReadQuality min) { this->min_signal_quality_ = min; };
@@ -16,6 +16,12 @@ bool ImageDecoder::set_size(int width, int height) {
 }
 
 void ImageDecoder::draw(int x, int y, int w, int h, const Color &color) {
+  if (w == 1 && h == 1 && this->x_scale_ == 1.0 && this->y_scale_ == 1.0) {
+    // Unscaled single pixel, as delivered by most decoders
+    if (x < this->image_->buffer_width_ && y < this->image_->buffer_height_)
+      this->image_->draw_pixel_(x, y, color);
+    return;
+  }
   auto width = std::min(this->image_->buffer_width_, static_cast<int>(std::ceil((x + w) * this->x_scale_)));
   auto height = std::min(this->image_->buffer_height_, static_cast<int>(std::ceil((y + h) * this->y_scale_)));
   for (int i = x * this->x_scale_; i < width; i++) {
@@ -25,6 +31,20 @@ void ImageDecoder::draw(int x, int y, int w, int h, const Color &color) {
   }
 }
 
+bool ImageDecoder::is_native_rgb565() const {
+  return this->image_->get_type() == image::IMAGE_TYPE_RGB565 &&
+         this->image_->transparency_ == image::TRANSPARENCY_OPAQUE && this->x_scale_ == 1.0 && this->y_scale_ == 1.0;
+}
+
+void ImageDecoder::draw_native(int x, int y, int w, int h, const uint8_t *pixels, size_t stride) {
+  if (this->image_->buffer_ == nullptr || x >= this->image_->buffer_width_)
+    return;
+  w = std::min(w, this->image_->buffer_width_ - x);
+  h = std::min(h, this->image_->buffer_height_ - y);
+  for (int row = 0; row < h; row++, pixels += stride)
+    memcpy(this->image_->buffer_ + this->image_->get_position_(x, y + row), pixels, w * 2);
+}
+
 DownloadBuffer::DownloadBuffer(size_t size) : size_(size) {
   this->buffer_ = this->allocator_.allocate(size);
   this->reset();
@@ -73,6 +73,25 @@ class ImageDecoder {
    */
   void draw(int x, int y, int w, int h, const Color &color);
 
+  /**
+   * @brief Whether decoded pixels can be copied straight into the image buffer with draw_native().
+   * This is the case for unscaled, opaque RGB565 images.
+   */
+  bool is_native_rgb565() const;
+
+  /**
+   * @brief Copy a block of RGB565 pixels, already in the byte order of the image, into the image buffer.
+   * Only valid if is_native_rgb565() returns true. The block is clipped to the image.
+   *
+   * @param x The left-most coordinate of the block.
+   * @param y The top-most coordinate of the block.
+   * @param w The width of the block.
+   * @param h The height of the block.
+   * @param pixels The pixel data, h rows of stride bytes.
+   * @param stride The distance between two rows of the pixel data in bytes.
+   */
+  void draw_native(int x, int y, int w, int h, const uint8_t *pixels, size_t stride);
+
   bool is_finished() const { return this->decoded_bytes_ == this->download_size_; }
 
  protected:
@@ -24,6 +24,12 @@ static int draw_callback(JPEGDRAW *jpeg) {
   // Some very big images take too long to decode, so feed the watchdog on each callback
   // to avoid crashing.
   App.feed_wdt();
+  if (jpeg->iBpp == 16) {
+    // The decoder already produced pixels in the image's RGB565 byte order
+    decoder->draw_native(jpeg->x, jpeg->y, jpeg->iWidth, jpeg->iHeight, reinterpret_cast<uint8_t *>(jpeg->pPixels),
+                         jpeg->iWidth * 2);
+    return 1;
+  }
   size_t position = 0;
   size_t height = static_cast<size_t>(jpeg->iHeight);
   size_t width = static_cast<size_t>(jpeg->iWidth);
@@ -73,12 +79,35 @@ int HOT JpegDecoder::decode(uint8_t *buffer, size_t size) {
   }
   ESP_LOGD(TAG, "Image size: %d x %d, bpp: %d", this->jpeg_.getWidth(), this->jpeg_.getHeight(), this->jpeg_.getBpp());
 
+  // Let the IDCT downscale large images, so fewer pixels need to be produced and resampled
+  int scale = this->image_->get_decode_scale(this->jpeg_.getWidth(), this->jpeg_.getHeight());
+  int options = 0;
+  switch (scale) {
+    case 2:
+      options = JPEG_SCALE_HALF;
+      break;
+    case 4:
+      options = JPEG_SCALE_QUARTER;
+      break;
+    case 8:
+      options = JPEG_SCALE_EIGHTH;
+      break;
+    default:
+      break;
+  }
+  if (scale != 1)
+    ESP_LOGD(TAG, "Decoding at 1/%d scale", scale);
+
   this->jpeg_.setUserPointer(this);
-  this->jpeg_.setPixelType(RGB8888);
-  if (!this->set_size(this->jpeg_.getWidth(), this->jpeg_.getHeight())) {
+  if (!this->set_size(this->jpeg_.getWidth() / scale, this->jpeg_.getHeight() / scale)) {
     return DECODE_ERROR_OUT_OF_MEMORY;
   }
-  if (!this->jpeg_.decode(0, 0, 0)) {
+  if (this->is_native_rgb565()) {
+    this->jpeg_.setPixelType(this->image_->is_big_endian() ? RGB565_BIG_ENDIAN : RGB565_LITTLE_ENDIAN);
+  } else {
+    this->jpeg_.setPixelType(RGB8888);
+  }
+  if (!this->jpeg_.decode(0, 0, options)) {
     ESP_LOGE(TAG, "Error while decoding.");
     this->jpeg_.close();
     return DECODE_ERROR_UNSUPPORTED_FORMAT;
@@ -101,6 +101,15 @@ size_t OnlineImage::resize_(int width_in, int height_in) {
   return new_size;
 }
 
+int OnlineImage::get_decode_scale(int width, int height) const {
+  if (this->is_auto_resize_())
+    return 1;
+  int scale = 1;
+  while (scale < 8 && width / (scale * 2) >= this->fixed_width_ && height / (scale * 2) >= this->fixed_height_)
+    scale *= 2;
+  return scale;
+}
+
 void OnlineImage::update() {
   if (this->decoder_) {
     ESP_LOGW(TAG, "Image already being updated.");
@@ -93,6 +93,15 @@ class OnlineImage : public PollingComponent,
    */
   size_t resize_download_buffer(size_t size) { return this->download_buffer_.resize(size); }
 
+  /**
+   * Largest power of two (up to 8) by which an image of the given size can be reduced while decoding, while still
+   * covering the configured size. Returns 1 if the image is sized automatically.
+   */
+  int get_decode_scale(int width, int height) const;
+
+  /** Whether 16 bit colors are stored in big-endian byte order. */
+  bool is_big_endian() const { return this->is_big_endian_; }
+
   void add_on_finished_callback(std::function<void(bool)> &&callback);
   void add_on_error_callback(std::function<void()> &&callback);
 
@@ -198,8 +207,7 @@ class OnlineImage : public PollingComponent,
 
   time_t start_time_;
 
-  friend bool ImageDecoder::set_size(int width, int height);
-  friend void ImageDecoder::draw(int x, int y, int w, int h, const Color &color);
+  friend class ImageDecoder;
 };
 
 template<typename... Ts> class OnlineImageSetUrlAction : public Action<Ts...> {
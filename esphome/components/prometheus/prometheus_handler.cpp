@@ -2,205 +2,268 @@
 #ifdef USE_NETWORK
 #include "esphome/core/application.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace prometheus {
 
+void MetricStream::hash_(const void *data, size_t len) {
+  // FNV-1a, incremental
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < len; i++) {
+    this->fingerprint_ ^= bytes[i];
+    this->fingerprint_ *= 16777619UL;
+  }
+}
+
+void MetricStream::print(const char *str) {
+  if (str == nullptr)
+    return;
+  this->hash_(str, strlen(str));
+  if (this->stream_ != nullptr)
+    this->stream_->print(str);
+}
+
+#ifndef USE_ESP32
+void MetricStream::print(const __FlashStringHelper *str) {
+  // Flash literals are fixed per call site, so their address is enough for the fingerprint
+  this->hash_(&str, sizeof(str));
+  if (this->stream_ != nullptr)
+    this->stream_->print(str);
+}
+#endif
+
+void MetricStream::print(const LogString *str) {
+  this->hash_(&str, sizeof(str));
+  if (this->stream_ == nullptr)
+    return;
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  this->stream_->print((const __FlashStringHelper *) str);
+#else
+  this->stream_->print((const char *) str);
+#endif
+}
+
+void MetricStream::print_value(float value, int8_t accuracy_decimals) {
+  this->hash_(&value, sizeof(value));
+  this->hash_(&accuracy_decimals, sizeof(accuracy_decimals));
+  if (this->stream_ == nullptr)
+    return;
+  char buf[32];
+  value_accuracy_with_uom_to_buf(buf, sizeof(buf), value, accuracy_decimals, StringRef());
+  this->stream_->print(buf);
+}
+
+void PrometheusHandler::setup() {
+  this->base_->init();
+  this->base_->add_handler(this);
+
+  // The device-wide labels never change at runtime, build them once instead of on every row
+  const char *area = App.get_area();
+  const std::string &node = App.get_name();
+  const std::string &friendly_name = App.get_friendly_name();
+  if (area != nullptr && *area != '\0') {
+    this->common_labels_.append("\",area=\"");
+    this->common_labels_.append(area);
+  }
+  if (!node.empty()) {
+    this->common_labels_.append("\",node=\"");
+    this->common_labels_.append(node);
+  }
+  if (!friendly_name.empty()) {
+    this->common_labels_.append("\",friendly_name=\"");
+    this->common_labels_.append(friendly_name);
+  }
+  this->common_labels_.append("\",name=\"");
+}
+
 void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+  char etag[11];  // quoted 8 digit hex
+  if (this->has_if_none_match_(req)) {
+    // Dry run without a response stream only hashes the raw values, which is much cheaper than formatting them
+    MetricStream probe(nullptr);
+    this->print_metrics_(&probe);
+    snprintf(etag, sizeof(etag), "\"%08" PRIx32 "\"", probe.get_fingerprint());
+    if (this->if_none_match_equals_(req, etag)) {
+      req->send(304);
+      return;
+    }
+  }
+
   AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
-  std::string area = App.get_area();
-  std::string node = App.get_name();
-  std::string friendly_name = App.get_friendly_name();
+  MetricStream metrics(stream);
+  this->print_metrics_(&metrics);
+  snprintf(etag, sizeof(etag), "\"%08" PRIx32 "\"", metrics.get_fingerprint());
+  stream->addHeader("ETag", etag);
+  req->send(stream);
+}
+
+bool PrometheusHandler::has_if_none_match_(AsyncWebServerRequest *req) { return req->hasHeader("If-None-Match"); }
+
+bool PrometheusHandler::if_none_match_equals_(AsyncWebServerRequest *req, const char *etag) {
+#ifdef USE_ESP32
+  auto header = req->get_header("If-None-Match");
+  return header.has_value() && header.value() == etag;
+#else
+  const AsyncWebHeader *header = req->getHeader("If-None-Match");
+  return header != nullptr && header->value() == etag;
+#endif
+}
 
+void PrometheusHandler::print_metrics_(MetricStream *stream) {
 #ifdef USE_SENSOR
   this->sensor_type_(stream);
   for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj, area, node, friendly_name);
+    this->sensor_row_(stream, obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   this->binary_sensor_type_(stream);
   for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj, area, node, friendly_name);
+    this->binary_sensor_row_(stream, obj);
 #endif
 
 #ifdef USE_FAN
   this->fan_type_(stream);
   for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj, area, node, friendly_name);
+    this->fan_row_(stream, obj);
 #endif
 
 #ifdef USE_LIGHT
   this->light_type_(stream);
   for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj, area, node, friendly_name);
+    this->light_row_(stream, obj);
 #endif
 
 #ifdef USE_COVER
   this->cover_type_(stream);
   for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj, area, node, friendly_name);
+    this->cover_row_(stream, obj);
 #endif
 
 #ifdef USE_SWITCH
   this->switch_type_(stream);
   for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj, area, node, friendly_name);
+    this->switch_row_(stream, obj);
 #endif
 
 #ifdef USE_LOCK
   this->lock_type_(stream);
   for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj, area, node, friendly_name);
+    this->lock_row_(stream, obj);
 #endif
 
 #ifdef USE_EVENT
   this->event_type_(stream);
   for (auto *obj : App.get_events())
-    this->event_row_(stream, obj, area, node, friendly_name);
+    this->event_row_(stream, obj);
 #endif
 
 #ifdef USE_TEXT
   this->text_type_(stream);
   for (auto *obj : App.get_texts())
-    this->text_row_(stream, obj, area, node, friendly_name);
+    this->text_row_(stream, obj);
 #endif
 
 #ifdef USE_TEXT_SENSOR
   this->text_sensor_type_(stream);
   for (auto *obj : App.get_text_sensors())
-    this->text_sensor_row_(stream, obj, area, node, friendly_name);
+    this->text_sensor_row_(stream, obj);
 #endif
 
 #ifdef USE_NUMBER
   this->number_type_(stream);
   for (auto *obj : App.get_numbers())
-    this->number_row_(stream, obj, area, node, friendly_name);
+    this->number_row_(stream, obj);
 #endif
 
 #ifdef USE_SELECT
   this->select_type_(stream);
   for (auto *obj : App.get_selects())
-    this->select_row_(stream, obj, area, node, friendly_name);
+    this->select_row_(stream, obj);
 #endif
 
 #ifdef USE_MEDIA_PLAYER
   this->media_player_type_(stream);
   for (auto *obj : App.get_media_players())
-    this->media_player_row_(stream, obj, area, node, friendly_name);
+    this->media_player_row_(stream, obj);
 #endif
 
 #ifdef USE_UPDATE
   this->update_entity_type_(stream);
   for (auto *obj : App.get_updates())
-    this->update_entity_row_(stream, obj, area, node, friendly_name);
+    this->update_entity_row_(stream, obj);
 #endif
 
 #ifdef USE_VALVE
   this->valve_type_(stream);
   for (auto *obj : App.get_valves())
-    this->valve_row_(stream, obj, area, node, friendly_name);
+    this->valve_row_(stream, obj);
 #endif
 
 #ifdef USE_CLIMATE
   this->climate_type_(stream);
   for (auto *obj : App.get_climates())
-    this->climate_row_(stream, obj, area, node, friendly_name);
+    this->climate_row_(stream, obj);
 #endif
-
-  req->send(stream);
-}
-
-std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
-  auto item = relabel_map_id_.find(obj);
-  return item == relabel_map_id_.end() ? obj->get_object_id() : item->second;
 }
 
-std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
-  auto item = relabel_map_name_.find(obj);
-  return item == relabel_map_name_.end() ? obj->get_name() : item->second;
-}
-
-void PrometheusHandler::add_area_label_(AsyncResponseStream *stream, std::string &area) {
-  if (!area.empty()) {
-    stream->print(ESPHOME_F("\",area=\""));
-    stream->print(area.c_str());
-  }
-}
-
-void PrometheusHandler::add_node_label_(AsyncResponseStream *stream, std::string &node) {
-  if (!node.empty()) {
-    stream->print(ESPHOME_F("\",node=\""));
-    stream->print(node.c_str());
-  }
-}
-
-void PrometheusHandler::add_friendly_name_label_(AsyncResponseStream *stream, std::string &friendly_name) {
-  if (!friendly_name.empty()) {
-    stream->print(ESPHOME_F("\",friendly_name=\""));
-    stream->print(friendly_name.c_str());
+void PrometheusHandler::print_entity_labels_(MetricStream *stream, EntityBase *obj) {
+  // Relabeled entities are rare, so the maps are only consulted when they are non-empty
+  auto id = this->relabel_map_id_.empty() ? this->relabel_map_id_.end() : this->relabel_map_id_.find(obj);
+  if (id != this->relabel_map_id_.end()) {
+    stream->print(id->second.c_str());
+  } else {
+    StringRef object_id = obj->get_object_id_ref_for_api_();
+    if (!object_id.empty()) {
+      stream->print(object_id.c_str());
+    } else {
+      // Dynamic object_id (name_add_mac_suffix) needs to be generated
+      stream->print(obj->get_object_id().c_str());
+    }
   }
+  stream->print(this->common_labels_.c_str());
+  auto name = this->relabel_map_name_.empty() ? this->relabel_map_name_.end() : this->relabel_map_name_.find(obj);
+  stream->print(name != this->relabel_map_name_.end() ? name->second.c_str() : obj->get_name().c_str());
 }
 
 #ifdef USE_ESP8266
-void PrometheusHandler::print_metric_labels_(AsyncResponseStream *stream, const __FlashStringHelper *metric_name,
-                                             EntityBase *obj, std::string &area, std::string &node,
-                                             std::string &friendly_name) {
+void PrometheusHandler::print_metric_labels_(MetricStream *stream, const __FlashStringHelper *metric_name,
+                                             EntityBase *obj) {
 #else
-void PrometheusHandler::print_metric_labels_(AsyncResponseStream *stream, const char *metric_name, EntityBase *obj,
-                                             std::string &area, std::string &node, std::string &friendly_name) {
+void PrometheusHandler::print_metric_labels_(MetricStream *stream, const char *metric_name, EntityBase *obj) {
 #endif
   stream->print(metric_name);
   stream->print(ESPHOME_F("{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
 }
 
 // Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::sensor_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_sensor_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_sensor_failed gauge\n"));
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::sensor_row_(MetricStream *stream, sensor::Sensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
     stream->print(ESPHOME_F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 0\n"));
     // Data itself
     stream->print(ESPHOME_F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\",unit=\""));
     stream->print(obj->get_unit_of_measurement_ref().c_str());
     stream->print(ESPHOME_F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
+    stream->print_value(obj->state, obj->get_accuracy_decimals());
     stream->print(ESPHOME_F("\n"));
   } else {
     // Invalid state
     stream->print(ESPHOME_F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 1\n"));
   }
 }
@@ -208,88 +271,56 @@ void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::binary_sensor_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_binary_sensor_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_binary_sensor_failed gauge\n"));
 }
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj,
-                                           std::string &area, std::string &node, std::string &friendly_name) {
+void PrometheusHandler::binary_sensor_row_(MetricStream *stream, binary_sensor::BinarySensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
     stream->print(ESPHOME_F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 0\n"));
     // Data itself
     stream->print(ESPHOME_F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} "));
     stream->print(obj->state);
     stream->print(ESPHOME_F("\n"));
   } else {
     // Invalid state
     stream->print(ESPHOME_F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::fan_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_fan_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_fan_failed gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_fan_speed gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_fan_oscillation gauge\n"));
 }
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std::string &area, std::string &node,
-                                 std::string &friendly_name) {
+void PrometheusHandler::fan_row_(MetricStream *stream, fan::Fan *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(ESPHOME_F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} 0\n"));
   // Data itself
   stream->print(ESPHOME_F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} "));
   stream->print(obj->state);
   stream->print(ESPHOME_F("\n"));
   // Speed if available
   if (obj->get_traits().supports_speed()) {
     stream->print(ESPHOME_F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} "));
     stream->print(obj->speed);
     stream->print(ESPHOME_F("\n"));
@@ -297,12 +328,7 @@ void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
     stream->print(ESPHOME_F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} "));
     stream->print(obj->oscillating);
     stream->print(ESPHOME_F("\n"));
@@ -311,17 +337,16 @@ void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::light_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_light_state gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_light_color gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_light_effect_active gauge\n"));
 }
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj, std::string &area,
-                                   std::string &node, std::string &friendly_name) {
+void PrometheusHandler::light_row_(MetricStream *stream, light::LightState *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   // State
-  print_metric_labels_(stream, ESPHOME_F("esphome_light_state"), obj, area, node, friendly_name);
+  print_metric_labels_(stream, ESPHOME_F("esphome_light_state"), obj);
   stream->print(ESPHOME_F("\"} "));
   stream->print(obj->remote_values.is_on());
   stream->print(ESPHOME_F("\n"));
@@ -331,27 +356,27 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
   if (obj->get_traits().supports_color_capability(light::ColorCapability::BRIGHTNESS)) {
-    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj, area, node, friendly_name);
+    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj);
     stream->print(ESPHOME_F("\",channel=\"brightness\"} "));
     stream->print(brightness);
     stream->print(ESPHOME_F("\n"));
   }
   if (obj->get_traits().supports_color_capability(light::ColorCapability::RGB)) {
-    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj, area, node, friendly_name);
+    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj);
     stream->print(ESPHOME_F("\",channel=\"r\"} "));
     stream->print(r);
     stream->print(ESPHOME_F("\n"));
-    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj, area, node, friendly_name);
+    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj);
     stream->print(ESPHOME_F("\",channel=\"g\"} "));
     stream->print(g);
     stream->print(ESPHOME_F("\n"));
-    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj, area, node, friendly_name);
+    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj);
     stream->print(ESPHOME_F("\",channel=\"b\"} "));
     stream->print(b);
     stream->print(ESPHOME_F("\n"));
   }
   if (obj->get_traits().supports_color_capability(light::ColorCapability::WHITE)) {
-    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj, area, node, friendly_name);
+    print_metric_labels_(stream, ESPHOME_F("esphome_light_color"), obj);
     stream->print(ESPHOME_F("\",channel=\"w\"} "));
     stream->print(w);
     stream->print(ESPHOME_F("\n"));
@@ -360,7 +385,7 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
   if (!obj->get_effects().empty()) {
     // Effect
     std::string effect = obj->get_effect_name();
-    print_metric_labels_(stream, ESPHOME_F("esphome_light_effect_active"), obj, area, node, friendly_name);
+    print_metric_labels_(stream, ESPHOME_F("esphome_light_effect_active"), obj);
     stream->print(ESPHOME_F("\",effect=\""));
     // Only vary based on effect
     if (effect == "None") {
@@ -374,43 +399,27 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::cover_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_cover_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_cover_failed gauge\n"));
 }
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj, std::string &area, std::string &node,
-                                   std::string &friendly_name) {
+void PrometheusHandler::cover_row_(MetricStream *stream, cover::Cover *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
     stream->print(ESPHOME_F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 0\n"));
     // Data itself
     stream->print(ESPHOME_F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} "));
     stream->print(obj->position);
     stream->print(ESPHOME_F("\n"));
     if (obj->get_traits().get_supports_tilt()) {
       stream->print(ESPHOME_F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      add_area_label_(stream, area);
-      add_node_label_(stream, node);
-      add_friendly_name_label_(stream, friendly_name);
-      stream->print(ESPHOME_F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
+      this->print_entity_labels_(stream, obj);
       stream->print(ESPHOME_F("\"} "));
       stream->print(obj->tilt);
       stream->print(ESPHOME_F("\n"));
@@ -418,42 +427,26 @@ void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *ob
   } else {
     // Invalid state
     stream->print(ESPHOME_F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::switch_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_switch_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_switch_failed gauge\n"));
 }
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::switch_row_(MetricStream *stream, switch_::Switch *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(ESPHOME_F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} 0\n"));
   // Data itself
   stream->print(ESPHOME_F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} "));
   stream->print(obj->state);
   stream->print(ESPHOME_F("\n"));
@@ -461,30 +454,19 @@ void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::lock_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_lock_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_lock_failed gauge\n"));
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj, std::string &area, std::string &node,
-                                  std::string &friendly_name) {
+void PrometheusHandler::lock_row_(MetricStream *stream, lock::Lock *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(ESPHOME_F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} 0\n"));
   // Data itself
   stream->print(ESPHOME_F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} "));
   stream->print(obj->state);
   stream->print(ESPHOME_F("\n"));
@@ -493,32 +475,21 @@ void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj,
 
 // Type-specific implementation
 #ifdef USE_TEXT_SENSOR
-void PrometheusHandler::text_sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::text_sensor_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_text_sensor_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_text_sensor_failed gauge\n"));
 }
-void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_sensor::TextSensor *obj, std::string &area,
-                                         std::string &node, std::string &friendly_name) {
+void PrometheusHandler::text_sensor_row_(MetricStream *stream, text_sensor::TextSensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
     stream->print(ESPHOME_F("esphome_text_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 0\n"));
     // Data itself
     stream->print(ESPHOME_F("esphome_text_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\",value=\""));
     stream->print(obj->state.c_str());
     stream->print(ESPHOME_F("\"} "));
@@ -527,12 +498,7 @@ void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_senso
   } else {
     // Invalid state
     stream->print(ESPHOME_F("esphome_text_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 1\n"));
   }
 }
@@ -540,32 +506,21 @@ void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_senso
 
 // Type-specific implementation
 #ifdef USE_TEXT
-void PrometheusHandler::text_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::text_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_text_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_text_failed gauge\n"));
 }
-void PrometheusHandler::text_row_(AsyncResponseStream *stream, text::Text *obj, std::string &area, std::string &node,
-                                  std::string &friendly_name) {
+void PrometheusHandler::text_row_(MetricStream *stream, text::Text *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
     stream->print(ESPHOME_F("esphome_text_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 0\n"));
     // Data itself
     stream->print(ESPHOME_F("esphome_text_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\",value=\""));
     stream->print(obj->state.c_str());
     stream->print(ESPHOME_F("\"} "));
@@ -574,12 +529,7 @@ void PrometheusHandler::text_row_(AsyncResponseStream *stream, text::Text *obj,
   } else {
     // Invalid state
     stream->print(ESPHOME_F("esphome_text_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 1\n"));
   }
 }
@@ -587,32 +537,21 @@ void PrometheusHandler::text_row_(AsyncResponseStream *stream, text::Text *obj,
 
 // Type-specific implementation
 #ifdef USE_EVENT
-void PrometheusHandler::event_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::event_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_event_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_event_failed gauge\n"));
 }
-void PrometheusHandler::event_row_(AsyncResponseStream *stream, event::Event *obj, std::string &area, std::string &node,
-                                   std::string &friendly_name) {
+void PrometheusHandler::event_row_(MetricStream *stream, event::Event *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->get_last_event_type() != nullptr) {
     // We have a valid event type, output this value
     stream->print(ESPHOME_F("esphome_event_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 0\n"));
     // Data itself
     stream->print(ESPHOME_F("esphome_event_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\",last_event_type=\""));
     stream->print(obj->get_last_event_type());
     stream->print(ESPHOME_F("\"} "));
@@ -621,12 +560,7 @@ void PrometheusHandler::event_row_(AsyncResponseStream *stream, event::Event *ob
   } else {
     // No event triggered yet
     stream->print(ESPHOME_F("esphome_event_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 1\n"));
   }
 }
@@ -634,76 +568,49 @@ void PrometheusHandler::event_row_(AsyncResponseStream *stream, event::Event *ob
 
 // Type-specific implementation
 #ifdef USE_NUMBER
-void PrometheusHandler::number_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::number_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_number_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_number_failed gauge\n"));
 }
-void PrometheusHandler::number_row_(AsyncResponseStream *stream, number::Number *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::number_row_(MetricStream *stream, number::Number *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
     stream->print(ESPHOME_F("esphome_number_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 0\n"));
     // Data itself
     stream->print(ESPHOME_F("esphome_number_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} "));
     stream->print(obj->state);
     stream->print(ESPHOME_F("\n"));
   } else {
     // Invalid state
     stream->print(ESPHOME_F("esphome_number_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_SELECT
-void PrometheusHandler::select_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::select_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_select_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_select_failed gauge\n"));
 }
-void PrometheusHandler::select_row_(AsyncResponseStream *stream, select::Select *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::select_row_(MetricStream *stream, select::Select *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
     stream->print(ESPHOME_F("esphome_select_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 0\n"));
     // Data itself
     stream->print(ESPHOME_F("esphome_select_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\",value=\""));
     stream->print(obj->current_option());
     stream->print(ESPHOME_F("\"} "));
@@ -712,66 +619,40 @@ void PrometheusHandler::select_row_(AsyncResponseStream *stream, select::Select
   } else {
     // Invalid state
     stream->print(ESPHOME_F("esphome_select_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-void PrometheusHandler::media_player_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::media_player_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_media_player_state_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_media_player_volume gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_media_player_is_muted gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_media_player_failed gauge\n"));
 }
-void PrometheusHandler::media_player_row_(AsyncResponseStream *stream, media_player::MediaPlayer *obj,
-                                          std::string &area, std::string &node, std::string &friendly_name) {
+void PrometheusHandler::media_player_row_(MetricStream *stream, media_player::MediaPlayer *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(ESPHOME_F("esphome_media_player_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} 0\n"));
   // Data itself
   stream->print(ESPHOME_F("esphome_media_player_state_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\",value=\""));
   stream->print(media_player::media_player_state_to_string(obj->state));
   stream->print(ESPHOME_F("\"} "));
   stream->print(ESPHOME_F("1.0"));
   stream->print(ESPHOME_F("\n"));
   stream->print(ESPHOME_F("esphome_media_player_volume{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} "));
   stream->print(obj->volume);
   stream->print(ESPHOME_F("\n"));
   stream->print(ESPHOME_F("esphome_media_player_is_muted{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} "));
   if (obj->is_muted()) {
     stream->print(ESPHOME_F("1.0"));
@@ -783,13 +664,13 @@ void PrometheusHandler::media_player_row_(AsyncResponseStream *stream, media_pla
 #endif
 
 #ifdef USE_UPDATE
-void PrometheusHandler::update_entity_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::update_entity_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_update_entity_state gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_update_entity_info gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_update_entity_failed gauge\n"));
 }
 
-void PrometheusHandler::handle_update_state_(AsyncResponseStream *stream, update::UpdateState state) {
+void PrometheusHandler::handle_update_state_(MetricStream *stream, update::UpdateState state) {
   switch (state) {
     case update::UpdateState::UPDATE_STATE_UNKNOWN:
       stream->print("unknown");
@@ -809,28 +690,17 @@ void PrometheusHandler::handle_update_state_(AsyncResponseStream *stream, update
   }
 }
 
-void PrometheusHandler::update_entity_row_(AsyncResponseStream *stream, update::UpdateEntity *obj, std::string &area,
-                                           std::string &node, std::string &friendly_name) {
+void PrometheusHandler::update_entity_row_(MetricStream *stream, update::UpdateEntity *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
     stream->print(ESPHOME_F("esphome_update_entity_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 0\n"));
     // First update state
     stream->print(ESPHOME_F("esphome_update_entity_state{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\",value=\""));
     handle_update_state_(stream, obj->state);
     stream->print(ESPHOME_F("\"} "));
@@ -838,12 +708,7 @@ void PrometheusHandler::update_entity_row_(AsyncResponseStream *stream, update::
     stream->print(ESPHOME_F("\n"));
     // Next update info
     stream->print(ESPHOME_F("esphome_update_entity_info{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\",current_version=\""));
     stream->print(obj->update_info.current_version.c_str());
     stream->print(ESPHOME_F("\",latest_version=\""));
@@ -856,62 +721,37 @@ void PrometheusHandler::update_entity_row_(AsyncResponseStream *stream, update::
   } else {
     // Invalid state
     stream->print(ESPHOME_F("esphome_update_entity_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_VALVE
-void PrometheusHandler::valve_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::valve_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_valve_operation gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_valve_failed gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_valve_position gauge\n"));
 }
 
-void PrometheusHandler::valve_row_(AsyncResponseStream *stream, valve::Valve *obj, std::string &area, std::string &node,
-                                   std::string &friendly_name) {
+void PrometheusHandler::valve_row_(MetricStream *stream, valve::Valve *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   stream->print(ESPHOME_F("esphome_valve_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\"} 0\n"));
   // Data itself
   stream->print(ESPHOME_F("esphome_valve_operation{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\",operation=\""));
-#ifdef USE_STORE_LOG_STR_IN_FLASH
-  stream->print((const __FlashStringHelper *) valve::valve_operation_to_str(obj->current_operation));
-#else
-  stream->print((const char *) valve::valve_operation_to_str(obj->current_operation));
-#endif
+  stream->print(valve::valve_operation_to_str(obj->current_operation));
   stream->print(ESPHOME_F("\"} "));
   stream->print(ESPHOME_F("1.0"));
   stream->print(ESPHOME_F("\n"));
   // Now see if position is supported
   if (obj->get_traits().get_supports_position()) {
     stream->print(ESPHOME_F("esphome_valve_position{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    this->print_entity_labels_(stream, obj);
     stream->print(ESPHOME_F("\"} "));
     stream->print(obj->position);
     stream->print(ESPHOME_F("\n"));
@@ -920,60 +760,42 @@ void PrometheusHandler::valve_row_(AsyncResponseStream *stream, valve::Valve *ob
 #endif
 
 #ifdef USE_CLIMATE
-void PrometheusHandler::climate_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::climate_type_(MetricStream *stream) {
   stream->print(ESPHOME_F("#TYPE esphome_climate_setting gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_climate_value gauge\n"));
   stream->print(ESPHOME_F("#TYPE esphome_climate_failed gauge\n"));
 }
 
-void PrometheusHandler::climate_setting_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                             std::string &node, std::string &friendly_name, std::string &setting,
+void PrometheusHandler::climate_setting_row_(MetricStream *stream, climate::Climate *obj, const char *setting,
                                              const LogString *setting_value) {
   stream->print(ESPHOME_F("esphome_climate_setting{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\",category=\""));
-  stream->print(setting.c_str());
+  stream->print(setting);
   stream->print(ESPHOME_F("\",setting_value=\""));
-  stream->print(LOG_STR_ARG(setting_value));
+  stream->print(setting_value);
   stream->print(ESPHOME_F("\"} "));
   stream->print(ESPHOME_F("1.0"));
   stream->print(ESPHOME_F("\n"));
 }
 
-void PrometheusHandler::climate_value_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                           std::string &node, std::string &friendly_name, std::string &category,
-                                           std::string &climate_value) {
+void PrometheusHandler::climate_value_row_(MetricStream *stream, climate::Climate *obj, const char *category,
+                                           float value, int8_t accuracy_decimals) {
   stream->print(ESPHOME_F("esphome_climate_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\",category=\""));
-  stream->print(category.c_str());
+  stream->print(category);
   stream->print(ESPHOME_F("\"} "));
-  stream->print(climate_value.c_str());
+  stream->print_value(value, accuracy_decimals);
   stream->print(ESPHOME_F("\n"));
 }
 
-void PrometheusHandler::climate_failed_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                            std::string &node, std::string &friendly_name, std::string &category,
+void PrometheusHandler::climate_failed_row_(MetricStream *stream, climate::Climate *obj, const char *category,
                                             bool is_failed_value) {
   stream->print(ESPHOME_F("esphome_climate_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  this->print_entity_labels_(stream, obj);
   stream->print(ESPHOME_F("\",category=\""));
-  stream->print(category.c_str());
+  stream->print(category);
   stream->print(ESPHOME_F("\"} "));
   if (is_failed_value) {
     stream->print(ESPHOME_F("1.0"));
@@ -983,108 +805,99 @@ void PrometheusHandler::climate_failed_row_(AsyncResponseStream *stream, climate
   stream->print(ESPHOME_F("\n"));
 }
 
-void PrometheusHandler::climate_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                     std::string &node, std::string &friendly_name) {
+void PrometheusHandler::climate_row_(MetricStream *stream, climate::Climate *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   // Data itself
   bool any_failures = false;
-  std::string climate_mode_category = "mode";
+  const char *climate_mode_category = "mode";
   const auto *climate_mode_value = climate::climate_mode_to_string(obj->mode);
-  climate_setting_row_(stream, obj, area, node, friendly_name, climate_mode_category, climate_mode_value);
+  climate_setting_row_(stream, obj, climate_mode_category, climate_mode_value);
   const auto traits = obj->get_traits();
   // Now see if traits is supported
   int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
   int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
   // max temp
-  std::string max_temp = "maximum_temperature";
-  auto max_temp_value = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
-  climate_value_row_(stream, obj, area, node, friendly_name, max_temp, max_temp_value);
+  const char *max_temp = "maximum_temperature";
+  climate_value_row_(stream, obj, max_temp, traits.get_visual_max_temperature(), target_accuracy);
   // max temp
-  std::string min_temp = "mininum_temperature";
-  auto min_temp_value = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
-  climate_value_row_(stream, obj, area, node, friendly_name, min_temp, min_temp_value);
+  const char *min_temp = "mininum_temperature";
+  climate_value_row_(stream, obj, min_temp, traits.get_visual_min_temperature(), target_accuracy);
   // now check optional traits
   if (traits.has_feature_flags(climate::CLIMATE_SUPPORTS_CURRENT_TEMPERATURE)) {
-    std::string current_temp = "current_temperature";
+    const char *current_temp = "current_temperature";
     if (std::isnan(obj->current_temperature)) {
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_temp, true);
+      climate_failed_row_(stream, obj, current_temp, true);
       any_failures = true;
     } else {
-      auto current_temp_value = value_accuracy_to_string(obj->current_temperature, current_accuracy);
-      climate_value_row_(stream, obj, area, node, friendly_name, current_temp, current_temp_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_temp, false);
+      climate_value_row_(stream, obj, current_temp, obj->current_temperature, current_accuracy);
+      climate_failed_row_(stream, obj, current_temp, false);
     }
   }
   if (traits.has_feature_flags(climate::CLIMATE_SUPPORTS_CURRENT_HUMIDITY)) {
-    std::string current_humidity = "current_humidity";
+    const char *current_humidity = "current_humidity";
     if (std::isnan(obj->current_humidity)) {
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_humidity, true);
+      climate_failed_row_(stream, obj, current_humidity, true);
       any_failures = true;
     } else {
-      auto current_humidity_value = value_accuracy_to_string(obj->current_humidity, 0);
-      climate_value_row_(stream, obj, area, node, friendly_name, current_humidity, current_humidity_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_humidity, false);
+      climate_value_row_(stream, obj, current_humidity, obj->current_humidity, 0);
+      climate_failed_row_(stream, obj, current_humidity, false);
     }
   }
   if (traits.has_feature_flags(climate::CLIMATE_SUPPORTS_TARGET_HUMIDITY)) {
-    std::string target_humidity = "target_humidity";
+    const char *target_humidity = "target_humidity";
     if (std::isnan(obj->target_humidity)) {
-      climate_failed_row_(stream, obj, area, node, friendly_name, target_humidity, true);
+      climate_failed_row_(stream, obj, target_humidity, true);
       any_failures = true;
     } else {
-      auto target_humidity_value = value_accuracy_to_string(obj->target_humidity, 0);
-      climate_value_row_(stream, obj, area, node, friendly_name, target_humidity, target_humidity_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, target_humidity, false);
+      climate_value_row_(stream, obj, target_humidity, obj->target_humidity, 0);
+      climate_failed_row_(stream, obj, target_humidity, false);
     }
   }
   if (traits.has_feature_flags(climate::CLIMATE_SUPPORTS_TWO_POINT_TARGET_TEMPERATURE |
                                climate::CLIMATE_REQUIRES_TWO_POINT_TARGET_TEMPERATURE)) {
-    std::string target_temp_low = "target_temperature_low";
-    auto target_temp_low_value = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
-    climate_value_row_(stream, obj, area, node, friendly_name, target_temp_low, target_temp_low_value);
-    std::string target_temp_high = "target_temperature_high";
-    auto target_temp_high_value = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
-    climate_value_row_(stream, obj, area, node, friendly_name, target_temp_high, target_temp_high_value);
+    const char *target_temp_low = "target_temperature_low";
+    climate_value_row_(stream, obj, target_temp_low, obj->target_temperature_low, target_accuracy);
+    const char *target_temp_high = "target_temperature_high";
+    climate_value_row_(stream, obj, target_temp_high, obj->target_temperature_high, target_accuracy);
   } else {
-    std::string target_temp = "target_temperature";
-    auto target_temp_value = value_accuracy_to_string(obj->target_temperature, target_accuracy);
-    climate_value_row_(stream, obj, area, node, friendly_name, target_temp, target_temp_value);
+    const char *target_temp = "target_temperature";
+    climate_value_row_(stream, obj, target_temp, obj->target_temperature, target_accuracy);
   }
   if (traits.has_feature_flags(climate::CLIMATE_SUPPORTS_ACTION)) {
-    std::string climate_trait_category = "action";
+    const char *climate_trait_category = "action";
     const auto *climate_trait_value = climate::climate_action_to_string(obj->action);
-    climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
+    climate_setting_row_(stream, obj, climate_trait_category, climate_trait_value);
   }
   if (traits.get_supports_fan_modes()) {
-    std::string climate_trait_category = "fan_mode";
+    const char *climate_trait_category = "fan_mode";
     if (obj->fan_mode.has_value()) {
       const auto *climate_trait_value = climate::climate_fan_mode_to_string(obj->fan_mode.value());
-      climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, false);
+      climate_setting_row_(stream, obj, climate_trait_category, climate_trait_value);
+      climate_failed_row_(stream, obj, climate_trait_category, false);
     } else {
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, true);
+      climate_failed_row_(stream, obj, climate_trait_category, true);
       any_failures = true;
     }
   }
   if (traits.get_supports_presets()) {
-    std::string climate_trait_category = "preset";
+    const char *climate_trait_category = "preset";
     if (obj->preset.has_value()) {
       const auto *climate_trait_value = climate::climate_preset_to_string(obj->preset.value());
-      climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, false);
+      climate_setting_row_(stream, obj, climate_trait_category, climate_trait_value);
+      climate_failed_row_(stream, obj, climate_trait_category, false);
     } else {
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, true);
+      climate_failed_row_(stream, obj, climate_trait_category, true);
       any_failures = true;
     }
   }
   if (traits.get_supports_swing_modes()) {
-    std::string climate_trait_category = "swing_mode";
+    const char *climate_trait_category = "swing_mode";
     const auto *climate_trait_value = climate::climate_swing_mode_to_string(obj->swing_mode);
-    climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
+    climate_setting_row_(stream, obj, climate_trait_category, climate_trait_value);
   }
-  std::string all_climate_category = "all";
-  climate_failed_row_(stream, obj, area, node, friendly_name, all_climate_category, any_failures);
+  const char *all_climate_category = "all";
+  climate_failed_row_(stream, obj, all_climate_category, any_failures);
 }
 #endif
 
@@ -2,19 +2,50 @@
 #include "esphome/core/defines.h"
 #ifdef USE_NETWORK
 #include <map>
+#include <type_traits>
 #include <utility>
 
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
-#ifdef USE_CLIMATE
 #include "esphome/core/log.h"
-#endif
 
 namespace esphome {
 namespace prometheus {
 
+/** Forwards metric text to an AsyncResponseStream while fingerprinting everything printed, which is used as the ETag.
+ *
+ * Values are fingerprinted by their raw representation, so a stream without a response (nullptr) skips all number
+ * formatting and serves as a cheap way to check If-None-Match before rendering the body.
+ */
+class MetricStream {
+ public:
+  explicit MetricStream(AsyncResponseStream *stream) : stream_(stream) {}
+
+  void print(const char *str);
+#ifndef USE_ESP32
+  void print(const __FlashStringHelper *str);
+#endif
+  void print(const LogString *str);
+  /// Print a value with the given number of decimals; a dry run only hashes the raw value and skips the formatting.
+  void print_value(float value, int8_t accuracy_decimals);
+  template<typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value || std::is_enum<T>::value>>
+  void print(T value) {
+    this->hash_(&value, sizeof(value));
+    if (this->stream_ != nullptr)
+      this->stream_->print(value);
+  }
+
+  uint32_t get_fingerprint() const { return this->fingerprint_; }
+
+ protected:
+  void hash_(const void *data, size_t len);
+
+  AsyncResponseStream *stream_;
+  uint32_t fingerprint_{2166136261UL};
+};
+
 class PrometheusHandler : public AsyncWebHandler, public Component {
  public:
   PrometheusHandler(web_server_base::WebServerBase *base) : base_(base) {}
@@ -51,167 +82,148 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
  protected:
-  std::string relabel_id_(EntityBase *obj);
-  std::string relabel_name_(EntityBase *obj);
-  void add_area_label_(AsyncResponseStream *stream, std::string &area);
-  void add_node_label_(AsyncResponseStream *stream, std::string &node);
-  void add_friendly_name_label_(AsyncResponseStream *stream, std::string &friendly_name);
+  bool has_if_none_match_(AsyncWebServerRequest *req);
+  bool if_none_match_equals_(AsyncWebServerRequest *req, const char *etag);
+  /// Print all metrics of all entity types
+  void print_metrics_(MetricStream *stream);
+  /// Print the id label value, the precomputed area/node/friendly_name labels and the name label value
+  void print_entity_labels_(MetricStream *stream, EntityBase *obj);
   /// Print metric name and common labels (id, area, node, friendly_name, name)
 #ifdef USE_ESP8266
-  void print_metric_labels_(AsyncResponseStream *stream, const __FlashStringHelper *metric_name, EntityBase *obj,
-                            std::string &area, std::string &node, std::string &friendly_name);
+  void print_metric_labels_(MetricStream *stream, const __FlashStringHelper *metric_name, EntityBase *obj);
 #else
-  void print_metric_labels_(AsyncResponseStream *stream, const char *metric_name, EntityBase *obj, std::string &area,
-                            std::string &node, std::string &friendly_name);
+  void print_metric_labels_(MetricStream *stream, const char *metric_name, EntityBase *obj);
 #endif
 
 #ifdef USE_SENSOR
   /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
+  void sensor_type_(MetricStream *stream);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void sensor_row_(MetricStream *stream, sensor::Sensor *obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
+  void binary_sensor_type_(MetricStream *stream);
   /// Return the binary sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj, std::string &area,
-                          std::string &node, std::string &friendly_name);
+  void binary_sensor_row_(MetricStream *stream, binary_sensor::BinarySensor *obj);
 #endif
 
 #ifdef USE_FAN
   /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
+  void fan_type_(MetricStream *stream);
   /// Return the fan state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std::string &area, std::string &node,
-                std::string &friendly_name);
+  void fan_row_(MetricStream *stream, fan::Fan *obj);
 #endif
 
 #ifdef USE_LIGHT
   /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
+  void light_type_(MetricStream *stream);
   /// Return the light values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void light_row_(MetricStream *stream, light::LightState *obj);
 #endif
 
 #ifdef USE_COVER
   /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
+  void cover_type_(MetricStream *stream);
   /// Return the cover values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void cover_row_(MetricStream *stream, cover::Cover *obj);
 #endif
 
 #ifdef USE_SWITCH
   /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
+  void switch_type_(MetricStream *stream);
   /// Return the switch values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void switch_row_(MetricStream *stream, switch_::Switch *obj);
 #endif
 
 #ifdef USE_LOCK
   /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
+  void lock_type_(MetricStream *stream);
   /// Return the lock values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj, std::string &area, std::string &node,
-                 std::string &friendly_name);
+  void lock_row_(MetricStream *stream, lock::Lock *obj);
 #endif
 
 #ifdef USE_EVENT
   /// Return the type for prometheus
-  void event_type_(AsyncResponseStream *stream);
+  void event_type_(MetricStream *stream);
   /// Return the event values state as prometheus data point
-  void event_row_(AsyncResponseStream *stream, event::Event *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void event_row_(MetricStream *stream, event::Event *obj);
 #endif
 
 #ifdef USE_TEXT
   /// Return the type for prometheus
-  void text_type_(AsyncResponseStream *stream);
+  void text_type_(MetricStream *stream);
   /// Return the text values state as prometheus data point
-  void text_row_(AsyncResponseStream *stream, text::Text *obj, std::string &area, std::string &node,
-                 std::string &friendly_name);
+  void text_row_(MetricStream *stream, text::Text *obj);
 #endif
 
 #ifdef USE_TEXT_SENSOR
   /// Return the type for prometheus
-  void text_sensor_type_(AsyncResponseStream *stream);
+  void text_sensor_type_(MetricStream *stream);
   /// Return the text sensor values state as prometheus data point
-  void text_sensor_row_(AsyncResponseStream *stream, text_sensor::TextSensor *obj, std::string &area, std::string &node,
-                        std::string &friendly_name);
+  void text_sensor_row_(MetricStream *stream, text_sensor::TextSensor *obj);
 #endif
 
 #ifdef USE_NUMBER
   /// Return the type for prometheus
-  void number_type_(AsyncResponseStream *stream);
+  void number_type_(MetricStream *stream);
   /// Return the number state as prometheus data point
-  void number_row_(AsyncResponseStream *stream, number::Number *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void number_row_(MetricStream *stream, number::Number *obj);
 #endif
 
 #ifdef USE_SELECT
   /// Return the type for prometheus
-  void select_type_(AsyncResponseStream *stream);
+  void select_type_(MetricStream *stream);
   /// Return the select state as prometheus data point
-  void select_row_(AsyncResponseStream *stream, select::Select *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void select_row_(MetricStream *stream, select::Select *obj);
 #endif
 
 #ifdef USE_MEDIA_PLAYER
   /// Return the type for prometheus
-  void media_player_type_(AsyncResponseStream *stream);
+  void media_player_type_(MetricStream *stream);
   /// Return the media player state as prometheus data point
-  void media_player_row_(AsyncResponseStream *stream, media_player::MediaPlayer *obj, std::string &area,
-                         std::string &node, std::string &friendly_name);
+  void media_player_row_(MetricStream *stream, media_player::MediaPlayer *obj);
 #endif
 
 #ifdef USE_UPDATE
   /// Return the type for prometheus
-  void update_entity_type_(AsyncResponseStream *stream);
+  void update_entity_type_(MetricStream *stream);
   /// Return the update state and info as prometheus data point
-  void update_entity_row_(AsyncResponseStream *stream, update::UpdateEntity *obj, std::string &area, std::string &node,
-                          std::string &friendly_name);
-  void handle_update_state_(AsyncResponseStream *stream, update::UpdateState state);
+  void update_entity_row_(MetricStream *stream, update::UpdateEntity *obj);
+  void handle_update_state_(MetricStream *stream, update::UpdateState state);
 #endif
 
 #ifdef USE_VALVE
   /// Return the type for prometheus
-  void valve_type_(AsyncResponseStream *stream);
+  void valve_type_(MetricStream *stream);
   /// Return the valve state as prometheus data point
-  void valve_row_(AsyncResponseStream *stream, valve::Valve *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void valve_row_(MetricStream *stream, valve::Valve *obj);
 #endif
 
 #ifdef USE_CLIMATE
   /// Return the type for prometheus
-  void climate_type_(AsyncResponseStream *stream);
+  void climate_type_(MetricStream *stream);
   /// Return the climate state as prometheus data point
-  void climate_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                    std::string &friendly_name);
-  void climate_failed_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                           std::string &friendly_name, std::string &category, bool is_failed_value);
-  void climate_setting_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                            std::string &friendly_name, std::string &setting, const LogString *setting_value);
-  void climate_value_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                          std::string &friendly_name, std::string &category, std::string &climate_value);
+  void climate_row_(MetricStream *stream, climate::Climate *obj);
+  void climate_failed_row_(MetricStream *stream, climate::Climate *obj, const char *category, bool is_failed_value);
+  void climate_setting_row_(MetricStream *stream, climate::Climate *obj, const char *setting,
+                            const LogString *setting_value);
+  void climate_value_row_(MetricStream *stream, climate::Climate *obj, const char *category, float value,
+                          int8_t accuracy_decimals);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
+  /// Labels shared by all rows (area, node, friendly_name and the start of name), built once in setup()
+  std::string common_labels_;
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
 };
@@ -9,6 +9,7 @@ static const char *const TAG = "remote.aeha";
 
 static const uint16_t BITWISE = 425;
 static const uint16_t HEADER_HIGH_US = BITWISE * 8;
+static_assert(AEHAProtocol::LEADING_MARK_US == uint32_t(HEADER_HIGH_US), "header mark must match the leading mark");
 static const uint16_t HEADER_LOW_US = BITWISE * 4;
 static const uint16_t BIT_HIGH_US = BITWISE;
 static const uint16_t BIT_ONE_LOW_US = BITWISE * 3;
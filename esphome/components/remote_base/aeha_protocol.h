@@ -16,6 +16,8 @@ struct AEHAData {
 
 class AEHAProtocol : public RemoteProtocol<AEHAData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 3400;
+
   void encode(RemoteTransmitData *dst, const AEHAData &data) override;
   optional<AEHAData> decode(RemoteReceiveData src) override;
   void dump(const AEHAData &data) override;
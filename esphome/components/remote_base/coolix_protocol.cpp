@@ -8,6 +8,7 @@ static const char *const TAG = "remote.coolix";
 
 static const int32_t TICK_US = 560;
 static const int32_t HEADER_MARK_US = 8 * TICK_US;
+static_assert(CoolixProtocol::LEADING_MARK_US == uint32_t(HEADER_MARK_US), "header mark must match the leading mark");
 static const int32_t HEADER_SPACE_US = 8 * TICK_US;
 static const int32_t BIT_MARK_US = 1 * TICK_US;
 static const int32_t BIT_ONE_SPACE_US = 3 * TICK_US;
@@ -22,6 +22,8 @@ struct CoolixData {
 
 class CoolixProtocol : public RemoteProtocol<CoolixData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 4480;
+
   void encode(RemoteTransmitData *dst, const CoolixData &data) override;
   optional<CoolixData> decode(RemoteReceiveData data) override;
   void dump(const CoolixData &data) override;
@@ -14,6 +14,8 @@ struct DishData {
 
 class DishProtocol : public RemoteProtocol<DishData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 400;
+
   void encode(RemoteTransmitData *dst, const DishData &data) override;
   optional<DishData> decode(RemoteReceiveData src) override;
   void dump(const DishData &data) override;
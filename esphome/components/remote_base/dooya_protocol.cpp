@@ -6,7 +6,7 @@ namespace remote_base {
 
 static const char *const TAG = "remote.dooya";
 
-static const uint32_t HEADER_HIGH_US = 5000;
+static const uint32_t HEADER_HIGH_US = DooyaProtocol::LEADING_MARK_US;
 static const uint32_t HEADER_LOW_US = 1500;
 static const uint32_t BIT_ZERO_HIGH_US = 350;
 static const uint32_t BIT_ZERO_LOW_US = 750;
@@ -21,6 +21,8 @@ struct DooyaData {
 
 class DooyaProtocol : public RemoteProtocol<DooyaData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 5000;
+
   void encode(RemoteTransmitData *dst, const DooyaData &data) override;
   optional<DooyaData> decode(RemoteReceiveData src) override;
   void dump(const DooyaData &data) override;
@@ -12,7 +12,7 @@ static const char *const TAG = "remote.dyson";
 constexpr uint32_t PW_MARK_US = 780;
 constexpr uint32_t PW_SHORT_US = 720;
 constexpr uint32_t PW_LONG_US = 1500;
-constexpr uint32_t PW_START_US = 2280;
+constexpr uint32_t PW_START_US = DysonProtocol::LEADING_MARK_US;
 
 // MSB of 15 bit dyson code
 constexpr uint16_t MSB_DYSON = (1 << 14);
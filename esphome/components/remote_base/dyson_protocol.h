@@ -22,6 +22,8 @@ struct DysonData {
 
 class DysonProtocol : public RemoteProtocol<DysonData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 2280;
+
   void encode(RemoteTransmitData *dst, const DysonData &data) override;
   optional<DysonData> decode(RemoteReceiveData src) override;
   void dump(const DysonData &data) override;
@@ -62,6 +62,8 @@ class MideaData {
 
 class MideaProtocol : public RemoteProtocol<MideaData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 4480;
+
   void encode(RemoteTransmitData *dst, const MideaData &src) override;
   optional<MideaData> decode(RemoteReceiveData src) override;
   void dump(const MideaData &data) override;
@@ -6,7 +6,7 @@ namespace remote_base {
 
 static const char *const TAG = "remote.mirage";
 
-constexpr uint32_t HEADER_MARK_US = 8360;
+constexpr uint32_t HEADER_MARK_US = MirageProtocol::LEADING_MARK_US;
 constexpr uint32_t HEADER_SPACE_US = 4248;
 constexpr uint32_t BIT_MARK_US = 554;
 constexpr uint32_t BIT_ONE_SPACE_US = 1592;
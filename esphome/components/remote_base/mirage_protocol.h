@@ -14,6 +14,8 @@ struct MirageData {
 
 class MirageProtocol : public RemoteProtocol<MirageData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 8360;
+
   void encode(RemoteTransmitData *dst, const MirageData &data) override;
   optional<MirageData> decode(RemoteReceiveData src) override;
   void dump(const MirageData &data) override;
@@ -15,6 +15,8 @@ struct NECData {
 
 class NECProtocol : public RemoteProtocol<NECData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 9000;
+
   void encode(RemoteTransmitData *dst, const NECData &data) override;
   optional<NECData> decode(RemoteReceiveData src) override;
   void dump(const NECData &data) override;
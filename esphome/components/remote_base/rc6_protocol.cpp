@@ -9,6 +9,7 @@ static const char *const RC6_TAG = "remote.rc6";
 static const uint16_t RC6_FREQ = 36000;
 static const uint16_t RC6_UNIT = 444;
 static const uint16_t RC6_HEADER_MARK = (6 * RC6_UNIT);
+static_assert(RC6Protocol::LEADING_MARK_US == uint32_t(RC6_HEADER_MARK), "header mark must match the leading mark");
 static const uint16_t RC6_HEADER_SPACE = (2 * RC6_UNIT);
 static const uint16_t RC6_MODE_MASK = 0x07;
 
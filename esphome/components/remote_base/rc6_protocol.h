@@ -16,6 +16,8 @@ struct RC6Data {
 
 class RC6Protocol : public RemoteProtocol<RC6Data> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 2664;
+
   void encode(RemoteTransmitData *dst, const RC6Data &data) override;
   optional<RC6Data> decode(RemoteReceiveData src) override;
   void dump(const RC6Data &data) override;
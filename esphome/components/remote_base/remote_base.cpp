@@ -102,27 +102,57 @@ bool RemoteReceiverBinarySensorBase::on_receive(RemoteReceiveData src) {
 /* RemoteReceiverBase */
 
 void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
+  const uint32_t mark_bit = this->index_leading_mark_(dumper->get_leading_mark());
   if (dumper->is_secondary()) {
-    this->secondary_dumpers_.push_back(dumper);
+    this->secondary_dumpers_.push_back({dumper, mark_bit});
   } else {
-    this->dumpers_.push_back(dumper);
+    this->dumpers_.push_back({dumper, mark_bit});
   }
 }
 
-void RemoteReceiverBase::call_listeners_() {
-  for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+// Bit that is set for every frame, given to the decoders that are never skipped
+static const uint32_t UNFILTERED_BIT = uint32_t(1) << 31;
+
+uint32_t RemoteReceiverBase::index_leading_mark_(uint32_t mark) {
+  if (mark == 0)
+    return UNFILTERED_BIT;
+  for (size_t i = 0; i < this->leading_marks_.size(); i++) {
+    if (this->leading_marks_[i] == mark)
+      return uint32_t(1) << i;
+  }
+  if (this->leading_marks_.size() == 31)
+    return UNFILTERED_BIT;
+  this->leading_marks_.push_back(mark);
+  return uint32_t(1) << (this->leading_marks_.size() - 1);
+}
+
+uint32_t RemoteReceiverBase::match_leading_marks_(const RemoteReceiveData &src) const {
+  uint32_t matched = UNFILTERED_BIT;
+  for (size_t i = 0; i < this->leading_marks_.size(); i++) {
+    if (src.peek_mark(this->leading_marks_[i]))
+      matched |= uint32_t(1) << i;
+  }
+  return matched;
 }
 
-void RemoteReceiverBase::call_dumpers_() {
+void RemoteReceiverBase::call_listeners_(const RemoteReceiveData &src, uint32_t matched) {
+  for (auto &listener : this->listeners_) {
+    if (listener.mark_bit & matched)
+      listener.decoder->on_receive(src);
+  }
+}
+
+void RemoteReceiverBase::call_dumpers_(const RemoteReceiveData &src, uint32_t matched) {
   bool success = false;
-  for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_)))
+  for (auto &dumper : this->dumpers_) {
+    if ((dumper.mark_bit & matched) && dumper.decoder->dump(src))
       success = true;
   }
   if (!success) {
-    for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+    for (auto &dumper : this->secondary_dumpers_) {
+      if (dumper.mark_bit & matched)
+        dumper.decoder->dump(src);
+    }
   }
 }
 
@@ -168,21 +168,38 @@ class RemoteTransmitterBase : public RemoteComponentBase {
   RemoteTransmitData temp_;
 };
 
+/// Leading mark of a protocol's frames, otherwise 0. A protocol declares it as LEADING_MARK_US when its decoder only
+/// accepts frames that start with a mark of that length, so receivers can skip the decoder for all other frames.
+template<typename T> constexpr uint32_t protocol_leading_mark() {
+  if constexpr (requires { T::LEADING_MARK_US; }) {
+    return T::LEADING_MARK_US;
+  } else {
+    return 0;
+  }
+}
+
 class RemoteReceiverListener {
  public:
   virtual bool on_receive(RemoteReceiveData data) = 0;
+  /// Mark that every frame accepted by this listener starts with, or 0 if it accepts frames starting with anything.
+  /// The receiver skips the listener for frames that do not start with this mark.
+  virtual uint32_t get_leading_mark() const { return 0; }
 };
 
 class RemoteReceiverDumperBase {
  public:
   virtual bool dump(RemoteReceiveData src) = 0;
   virtual bool is_secondary() { return false; }
+  /// See RemoteReceiverListener::get_leading_mark()
+  virtual uint32_t get_leading_mark() const { return 0; }
 };
 
 class RemoteReceiverBase : public RemoteComponentBase {
  public:
   RemoteReceiverBase(InternalGPIOPin *pin) : RemoteComponentBase(pin) {}
-  void register_listener(RemoteReceiverListener *listener) { this->listeners_.push_back(listener); }
+  void register_listener(RemoteReceiverListener *listener) {
+    this->listeners_.push_back({listener, this->index_leading_mark_(listener->get_leading_mark())});
+  }
   void register_dumper(RemoteReceiverDumperBase *dumper);
   void set_tolerance(uint32_t tolerance, ToleranceMode tolerance_mode) {
     this->tolerance_ = tolerance;
@@ -190,16 +207,33 @@ class RemoteReceiverBase : public RemoteComponentBase {
   }
 
  protected:
-  void call_listeners_();
-  void call_dumpers_();
+  /// A registered decoder together with the bit of its leading mark in leading_marks_
+  template<typename T> struct Decoder {
+    T *decoder;
+    uint32_t mark_bit;
+  };
+
+  /// Returns the bit for a leading mark, adding the mark to leading_marks_ if it is new. Decoders without a leading
+  /// mark, or beyond the 31 distinct marks that fit the mask, get a bit that every frame matches.
+  uint32_t index_leading_mark_(uint32_t mark);
+  /// Returns the bits of all leading marks that src starts with plus the bit of the unfiltered decoders
+  uint32_t match_leading_marks_(const RemoteReceiveData &src) const;
+
+  void call_listeners_(const RemoteReceiveData &src, uint32_t matched);
+  void call_dumpers_(const RemoteReceiveData &src, uint32_t matched);
   void call_listeners_dumpers_() {
-    this->call_listeners_();
-    this->call_dumpers_();
+    const RemoteReceiveData src(this->temp_, this->tolerance_, this->tolerance_mode_);
+    const uint32_t matched = this->match_leading_marks_(src);
+    this->call_listeners_(src, matched);
+    this->call_dumpers_(src, matched);
   }
 
-  std::vector<RemoteReceiverListener *> listeners_;
-  std::vector<RemoteReceiverDumperBase *> dumpers_;
-  std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
+  std::vector<Decoder<RemoteReceiverListener>> listeners_;
+  std::vector<Decoder<RemoteReceiverDumperBase>> dumpers_;
+  std::vector<Decoder<RemoteReceiverDumperBase>> secondary_dumpers_;
+  /// Distinct leading marks of the registered decoders, so that a frame is only decoded by the protocols it can match
+  std::vector<uint32_t> leading_marks_;
+  /// Buffer the receivers fill with each frame; it is reused so its capacity is only allocated once
   RawTimings temp_;
   uint32_t tolerance_{25};
   ToleranceMode tolerance_mode_{TOLERANCE_MODE_PERCENTAGE};
@@ -228,6 +262,7 @@ template<typename T> class RemoteProtocol {
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
+  uint32_t get_leading_mark() const override { return protocol_leading_mark<T>(); }
 
  protected:
   bool matches(RemoteReceiveData src) override {
@@ -245,6 +280,9 @@ template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBin
 
 template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
+ public:
+  uint32_t get_leading_mark() const override { return protocol_leading_mark<T>(); }
+
  protected:
   bool on_receive(RemoteReceiveData src) override {
     auto proto = T();
@@ -288,6 +326,7 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
+  uint32_t get_leading_mark() const override { return protocol_leading_mark<T>(); }
   bool dump(RemoteReceiveData src) override {
     auto proto = T();
     auto decoded = proto.decode(src);
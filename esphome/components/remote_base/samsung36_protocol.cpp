@@ -8,7 +8,7 @@ static const char *const TAG = "remote.samsung36";
 
 static const uint8_t NBITS = 78;
 
-static const uint32_t HEADER_HIGH_US = 4500;
+static const uint32_t HEADER_HIGH_US = Samsung36Protocol::LEADING_MARK_US;
 static const uint32_t HEADER_LOW_US = 4500;
 static const uint32_t BIT_HIGH_US = 500;
 static const uint32_t BIT_ONE_LOW_US = 1500;
@@ -17,6 +17,8 @@ struct Samsung36Data {
 
 class Samsung36Protocol : public RemoteProtocol<Samsung36Data> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 4500;
+
   void encode(RemoteTransmitData *dst, const Samsung36Data &data) override;
   optional<Samsung36Data> decode(RemoteReceiveData src) override;
   void dump(const Samsung36Data &data) override;
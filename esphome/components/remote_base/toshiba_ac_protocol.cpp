@@ -7,7 +7,7 @@ namespace remote_base {
 
 static const char *const TAG = "remote.toshibaac";
 
-static const uint32_t HEADER_HIGH_US = 4500;
+static const uint32_t HEADER_HIGH_US = ToshibaAcProtocol::LEADING_MARK_US;
 static const uint32_t HEADER_LOW_US = 4500;
 static const uint32_t BIT_HIGH_US = 560;
 static const uint32_t BIT_ONE_LOW_US = 1690;
@@ -15,6 +15,8 @@ struct ToshibaAcData {
 
 class ToshibaAcProtocol : public RemoteProtocol<ToshibaAcData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 4500;
+
   void encode(RemoteTransmitData *dst, const ToshibaAcData &data) override;
   optional<ToshibaAcData> decode(RemoteReceiveData src) override;
   void dump(const ToshibaAcData &data) override;
@@ -6,7 +6,7 @@ namespace remote_base {
 
 static const char *const TAG = "remote.toto";
 
-static const uint32_t PREAMBLE_HIGH_US = 6200;
+static const uint32_t PREAMBLE_HIGH_US = TotoProtocol::LEADING_MARK_US;
 static const uint32_t PREAMBLE_LOW_US = 2800;
 static const uint32_t BIT_HIGH_US = 550;
 static const uint32_t BIT_ONE_LOW_US = 1700;
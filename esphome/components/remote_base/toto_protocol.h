@@ -17,6 +17,8 @@ struct TotoData {
 
 class TotoProtocol : public RemoteProtocol<TotoData> {
  public:
+  static constexpr uint32_t LEADING_MARK_US = 6200;
+
   void encode(RemoteTransmitData *dst, const TotoData &data) override;
   optional<TotoData> decode(RemoteReceiveData src) override;
   void dump(const TotoData &data) override;
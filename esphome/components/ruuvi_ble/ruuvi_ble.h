@@ -28,6 +28,9 @@ optional<RuuviParseResult> parse_ruuvi(const esp32_ble_tracker::ESPBTDevice &dev
 
 class RuuviListener : public esp32_ble_tracker::ESPBTDeviceListener {
  public:
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override {
+    return advertisement.has_manufacturer_id(esp32_ble_tracker::ESPBTUUID::from_uint16(0x0499));
+  }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 };
 
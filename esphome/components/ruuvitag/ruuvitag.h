@@ -14,6 +14,9 @@ class RuuviTag : public Component, public esp32_ble_tracker::ESPBTDeviceListener
  public:
   void set_address(uint64_t address) { address_ = address; }
 
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override {
+    return advertisement.address_uint64() == this->address_;
+  }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override {
     if (device.address_uint64() != this->address_)
       return false;
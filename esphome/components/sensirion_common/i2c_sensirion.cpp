@@ -19,7 +19,10 @@ bool SensirionI2CDevice::read_data(uint16_t *data, const uint8_t len) {
   if (this->last_error_ != i2c::ERROR_OK) {
     return false;
   }
+  return this->decode_data(buf, data, len);
+}
 
+bool SensirionI2CDevice::decode_data(const uint8_t *buf, uint16_t *data, uint8_t len) {
   for (uint8_t i = 0; i < len; i++) {
     const uint8_t j = 3 * i;
     // Use MSB first since Sensirion devices use CRC-8 with MSB first
@@ -35,6 +35,14 @@ class SensirionI2CDevice : public i2c::I2CDevice {
    */
   bool read_data(uint16_t &data) { return this->read_data(&data, 1); }
 
+  /** Check and unpack data words read from the I2C device by other means, such as an I2CTransaction.
+   * @param buf raw bytes, 3 per word
+   * @param data pointer to the unpacked words
+   * @param len number of words
+   * @return true if all CRCs matched
+   */
+  bool decode_data(const uint8_t *buf, uint16_t *data, uint8_t len);
+
   /** get data words from I2C register.
    * handles CRC check used by Sensirion sensors
    * @param  I2C register
@@ -39,6 +39,7 @@ from esphome.const import (
     CONF_TO,
     CONF_TRIGGER_ID,
     CONF_TYPE,
+    CONF_TYPE_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_VALUE,
     CONF_WEB_SERVER,
@@ -107,7 +108,7 @@ from esphome.const import (
 )
 from esphome.core import CORE, CoroPriority, coroutine_with_priority
 from esphome.core.entity_helpers import entity_duplicate_validator, setup_entity
-from esphome.cpp_generator import MockObjClass
+from esphome.cpp_generator import FloatLiteral, LambdaExpression, MockObjClass
 from esphome.util import Registry
 
 CODEOWNERS = ["@esphome/core"]
@@ -611,7 +612,8 @@ async def delta_filter_to_code(config, filter_id):
 
 @FILTER_REGISTRY.register("or", OrFilter, validate_filters)
 async def or_filter_to_code(config, filter_id):
-    filters = await build_filters(config)
+    # Every branch of an or filter sees the input value, so branches must not be fused
+    filters = await cg.build_registry_list(FILTER_REGISTRY, config)
     return cg.new_Pvariable(filter_id, filters)
 
 
@@ -751,6 +753,10 @@ def validate_calibrate_linear(config):
     ),
 )
 async def calibrate_linear_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, _calibrate_linear_functions(config))
+
+
+def _calibrate_linear_functions(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
 
@@ -760,7 +766,7 @@ async def calibrate_linear_filter_to_code(config, filter_id):
         linear_functions = [[k, b, float("NaN")]]
     elif config[CONF_METHOD] == "exact":
         linear_functions = map_linear(x, y)
-    return cg.new_Pvariable(filter_id, linear_functions)
+    return linear_functions
 
 
 CONF_DEGREE = "degree"
@@ -791,14 +797,17 @@ def validate_calibrate_polynomial(config):
     ),
 )
 async def calibrate_polynomial_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, _calibrate_polynomial_coefficients(config))
+
+
+def _calibrate_polynomial_coefficients(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
     degree = config[CONF_DEGREE]
     a = [[1] + [x_ ** (i + 1) for i in range(degree)] for x_ in x]
     # Column vector
     b = [[v] for v in y]
-    res = [v[0] for v in _lstsq(a, b)]
-    return cg.new_Pvariable(filter_id, res)
+    return [v[0] for v in _lstsq(a, b)]
 
 
 def validate_clamp(config):
@@ -867,8 +876,105 @@ async def round_multiple_filter_to_code(config, filter_id):
     )
 
 
+def _fused_float(value):
+    return str(FloatLiteral(float(value)))
+
+
+def _fused_filter_statements(key, config):
+    """Return C++ statements that apply a stateless filter to the float ``x``.
+
+    The statements perform exactly the same float operations as the filter class, so
+    a fused chain produces bit-identical results. Returns None for filters that keep
+    state, use templated values or cannot be expressed inline.
+    """
+    if key in ("offset", "multiply"):
+        if not isinstance(config, (int, float)) or not math.isfinite(config):
+            return None
+        op = "+" if key == "offset" else "*"
+        return [f"x = x {op} {_fused_float(config)};"]
+    if key == "calibrate_linear":
+        branches = []
+        fallback = "x = NAN;"
+        for k, b, limit in _calibrate_linear_functions(config):
+            if not all(math.isfinite(v) for v in (k, b)):
+                return None
+            apply = f"x = x * {_fused_float(k)} + {_fused_float(b)};"
+            if not math.isfinite(limit):
+                fallback = apply
+                break
+            branches.append((limit, apply))
+        if not branches:
+            return [fallback]
+        lines = []
+        for i, (limit, apply) in enumerate(branches):
+            prefix = "if" if i == 0 else "} else if"
+            lines += [f"{prefix} (x < {_fused_float(limit)}) {{", f"  {apply}"]
+        return lines + ["} else {", f"  {fallback}", "}"]
+    if key == "calibrate_polynomial":
+        coefficients = _calibrate_polynomial_coefficients(config)
+        if not all(math.isfinite(c) for c in coefficients):
+            return None
+        lines = ["{", "  float res = 0.0f;", "  float p = 1.0f;"]
+        for coefficient in coefficients:
+            lines += [f"  res += p * {_fused_float(coefficient)};", "  p *= x;"]
+        return lines + ["  x = res;", "}"]
+    if key == "clamp":
+        out_of_range = "return {{}};" if config[CONF_IGNORE_OUT_OF_RANGE] else "x = {};"
+        lines = []
+        for bound, op in ((config[CONF_MIN_VALUE], "<"), (config[CONF_MAX_VALUE], ">")):
+            if math.isfinite(bound):
+                limit = _fused_float(bound)
+                lines.append(
+                    f"if (std::isfinite(x) && x {op} {limit}) "
+                    + out_of_range.format(limit)
+                )
+        return lines
+    if key == "round":
+        mult = f"powf(10.0f, {config[CONF_ACCURACY_DECIMALS]})"
+        return [f"if (std::isfinite(x)) x = roundf({mult} * x) / {mult};"]
+    if key == "round_to_multiple_of":
+        multiple = _fused_float(config[CONF_MULTIPLE])
+        return [f"if (std::isfinite(x)) x = x - remainderf(x, {multiple});"]
+    return None
+
+
+async def _build_fused_filter(run):
+    """Build one filter for a run of (config, key, statements) stateless filters."""
+    if len(run) == 1:
+        return await cg.build_registry_entry(FILTER_REGISTRY, run[0][0])
+    filter_id = run[0][0][CONF_TYPE_ID].copy()
+    filter_id.type = StatelessLambdaFilter
+    parts = [f"// fused: {', '.join(key for _, key, _ in run)}\n"]
+    for _, _, statements in run:
+        parts += [f"{line}\n" for line in statements]
+    parts.append("return x;")
+    lambda_ = LambdaExpression(
+        parts, [(float, "x")], capture="", return_type=cg.optional.template(float)
+    )
+    return cg.new_Pvariable(filter_id, lambda_)
+
+
 async def build_filters(config):
-    return await cg.build_registry_list(FILTER_REGISTRY, config)
+    """Build a sensor filter chain.
+
+    Consecutive stateless arithmetic filters with constant parameters are fused into a
+    single StatelessLambdaFilter, saving one object and one virtual call per filter.
+    """
+    filters = []
+    run = []
+    for conf in config:
+        key = next(k for k in conf if k in FILTER_REGISTRY)
+        statements = _fused_filter_statements(key, conf[key])
+        if statements is not None:
+            run.append((conf, key, statements))
+            continue
+        if run:
+            filters.append(await _build_fused_filter(run))
+            run = []
+        filters.append(await cg.build_registry_entry(FILTER_REGISTRY, conf))
+    if run:
+        filters.append(await _build_fused_filter(run))
+    return filters
 
 
 async def setup_sensor_core_(var, config):
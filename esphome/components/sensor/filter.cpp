@@ -41,18 +41,21 @@ SlidingWindowFilter::SlidingWindowFilter(size_t window_size, size_t send_every,
 
 optional<float> SlidingWindowFilter::new_value(float value) {
   // Add value to ring buffer
+  float removed = NAN;
   if (this->window_count_ < this->window_size_) {
     // Buffer not yet full - just append
     this->window_.push_back(value);
     this->window_count_++;
   } else {
     // Buffer full - overwrite oldest value (ring buffer)
+    removed = this->window_[this->window_head_];
     this->window_[this->window_head_] = value;
     this->window_head_++;
     if (this->window_head_ >= this->window_size_) {
       this->window_head_ = 0;
     }
   }
+  this->on_window_update_(value, removed);
 
   // Check if we should send a result
   if (++this->send_at_ >= this->send_every_) {
@@ -65,41 +68,54 @@ optional<float> SlidingWindowFilter::new_value(float value) {
 }
 
 // SortedWindowFilter
-FixedVector<float> SortedWindowFilter::get_window_values_() {
-  // Copy window without NaN values using FixedVector (no heap allocation)
-  // Returns unsorted values - caller will use std::nth_element for partial sorting as needed
-  FixedVector<float> values;
-  values.init(this->window_count_);
-  for (size_t i = 0; i < this->window_count_; i++) {
-    float v = this->window_[i];
-    if (!std::isnan(v)) {
-      values.push_back(v);
+SortedWindowFilter::SortedWindowFilter(size_t window_size, size_t send_every, size_t send_first_at)
+    : SlidingWindowFilter(window_size, send_every, send_first_at) {
+  // Allocate the sorted array once; sorted_count_ tracks how much of it is in use
+  this->sorted_.init(window_size);
+  for (size_t i = 0; i < window_size; i++)
+    this->sorted_.push_back(NAN);
+}
+
+void SortedWindowFilter::on_window_update_(float value, float removed) {
+  float *first = this->sorted_.begin();
+  float *last = first + this->sorted_count_;
+  const bool add = !std::isnan(value);
+  if (!std::isnan(removed)) {
+    // The removed value is in the array, so lower_bound finds an equal entry
+    float *slot = std::lower_bound(first, last, removed);
+    if (!add) {
+      std::move(slot + 1, last, slot);
+      this->sorted_count_--;
+    } else if (removed < value) {
+      // Shift the entries between the old slot and the new position down by one
+      float *pos = std::upper_bound(slot + 1, last, value);
+      std::move(slot + 1, pos, slot);
+      *(pos - 1) = value;
+    } else {
+      // Shift the entries between the new position and the old slot up by one
+      float *pos = std::upper_bound(first, slot, value);
+      std::move_backward(pos, slot, slot + 1);
+      *pos = value;
     }
+  } else if (add) {
+    float *pos = std::upper_bound(first, last, value);
+    std::move_backward(pos, last, last + 1);
+    *pos = value;
+    this->sorted_count_++;
   }
-  return values;
 }
 
 // MedianFilter
 float MedianFilter::compute_result() {
-  FixedVector<float> values = this->get_window_values_();
-  if (values.empty())
+  size_t size = this->sorted_count_;
+  if (size == 0)
     return NAN;
 
-  size_t size = values.size();
   size_t mid = size / 2;
-
-  if (size % 2) {
-    // Odd number of elements - use nth_element to find middle element
-    std::nth_element(values.begin(), values.begin() + mid, values.end());
-    return values[mid];
-  }
-  // Even number of elements - need both middle elements
-  // Use nth_element to find upper middle element
-  std::nth_element(values.begin(), values.begin() + mid, values.end());
-  float upper = values[mid];
-  // Find the maximum of the lower half (which is now everything before mid)
-  float lower = *std::max_element(values.begin(), values.begin() + mid);
-  return (lower + upper) / 2.0f;
+  if (size % 2)
+    return this->sorted_[mid];
+  // Even number of elements - average the two middle elements
+  return (this->sorted_[mid - 1] + this->sorted_[mid]) / 2.0f;
 }
 
 // SkipInitialFilter
@@ -120,16 +136,13 @@ QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t sen
     : SortedWindowFilter(window_size, send_every, send_first_at), quantile_(quantile) {}
 
 float QuantileFilter::compute_result() {
-  FixedVector<float> values = this->get_window_values_();
-  if (values.empty())
+  size_t size = this->sorted_count_;
+  if (size == 0)
     return NAN;
 
-  size_t position = ceilf(values.size() * this->quantile_) - 1;
-  ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, values.size());
-
-  // Use nth_element to find the quantile element (O(n) instead of O(n log n))
-  std::nth_element(values.begin(), values.begin() + position, values.end());
-  return values[position];
+  size_t position = ceilf(size * this->quantile_) - 1;
+  ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, size);
+  return this->sorted_[position];
 }
 
 // MinFilter
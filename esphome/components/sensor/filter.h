@@ -59,6 +59,9 @@ class SlidingWindowFilter : public Filter {
   /// Called by new_value() to compute the filtered result from the current window
   virtual float compute_result() = 0;
 
+  /// Called by new_value() after value entered the window; removed is the value it replaced, NAN if none was replaced
+  virtual void on_window_update_(float value, float removed) {}
+
   /// Access the sliding window values (ring buffer implementation)
   /// Use: for (size_t i = 0; i < window_count_; i++) { float val = window_[i]; }
   FixedVector<float> window_;
@@ -95,17 +98,20 @@ class MinMaxFilter : public SlidingWindowFilter {
 
 /** Base class for filters that need a sorted window (Median, Quantile).
  *
- * Extends SlidingWindowFilter to provide a helper that filters out NaN values.
- * Derived classes use std::nth_element for efficient partial sorting.
+ * Keeps the non-NaN window values in a sorted array that is updated as values enter and leave the ring buffer.
+ * An update is a binary search plus a short memmove, and any rank can be read directly, so producing a result needs
+ * neither a copy of the window nor a selection pass.
  */
 class SortedWindowFilter : public SlidingWindowFilter {
  public:
-  using SlidingWindowFilter::SlidingWindowFilter;
+  SortedWindowFilter(size_t window_size, size_t send_every, size_t send_first_at);
 
  protected:
-  /// Helper to get non-NaN values from the window (not sorted - caller will use nth_element)
-  /// Returns empty FixedVector if all values are NaN
-  FixedVector<float> get_window_values_();
+  void on_window_update_(float value, float removed) override;
+
+  /// Sorted non-NaN window values; only the first sorted_count_ entries are valid
+  FixedVector<float> sorted_;
+  size_t sorted_count_{0};
 };
 
 /** Simple quantile filter.
@@ -16,7 +16,11 @@ from esphome.const import (
 
 CODEOWNERS = ["@sjtrny"]
 DEPENDENCIES = ["i2c"]
-AUTO_LOAD = ["sensirion_common"]
+
+
+def AUTO_LOAD() -> list[str]:
+    return ["sensirion_common", *i2c.async_transactions_auto_load()]
+
 
 sht4x_ns = cg.esphome_ns.namespace("sht4x")
 
@@ -91,6 +95,7 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     await i2c.register_i2c_device(var, config)
+    i2c.request_async_transactions()
 
     cg.add(var.set_precision_value(config[CONF_PRECISION]))
     cg.add(var.set_heater_power_value(config[CONF_HEATER_POWER]))
@@ -38,6 +38,10 @@ void SHT4XComponent::setup() {
 
   this->read_serial_number_();
 
+  this->measure_command_ = MEASURECOMMANDS[this->precision_];
+  this->measure_transaction_.write(&this->measure_command_, 1);
+  this->read_transaction_.read(this->measurement_, sizeof(this->measurement_));
+
   if (std::isfinite(this->duty_cycle_) && this->duty_cycle_ > 0.0f) {
     uint32_t heater_interval = static_cast<uint32_t>(static_cast<uint16_t>(this->heater_time_) / this->duty_cycle_);
     ESP_LOGD(TAG, "Heater interval: %" PRIu32, heater_interval);
@@ -83,43 +87,56 @@ void SHT4XComponent::dump_config() {
 }
 
 void SHT4XComponent::update() {
-  // Send command
-  if (!this->write_command(MEASURECOMMANDS[this->precision_])) {
-    // Warning will be printed only if warning status is not set yet
-    this->status_set_warning(LOG_STR("Failed to send measurement command"));
+  if (this->measure_transaction_.is_pending() || this->read_transaction_.is_pending())
     return;
-  }
-
-  this->set_timeout(10, [this]() {
-    uint16_t buffer[2];
 
-    // Read measurement
-    if (!this->read_data(buffer, 2)) {
-      // Using ESP_LOGW to force the warning to be printed
-      ESP_LOGW(TAG, "Sensor read failed");
-      this->status_set_warning();
+  // Send command
+  auto err = this->submit(&this->measure_transaction_, [this](i2c::ErrorCode err) {
+    if (err != i2c::ERROR_OK) {
+      // Warning will be printed only if warning status is not set yet
+      this->status_set_warning(LOG_STR("Failed to send measurement command"));
       return;
     }
+    this->set_timeout(10, [this]() { this->read_measurement_(); });
+  });
+  if (err != i2c::ERROR_OK)
+    this->status_set_warning(LOG_STR("Failed to send measurement command"));
+}
 
-    this->status_clear_warning();
+void SHT4XComponent::read_measurement_() {
+  auto err = this->submit(&this->read_transaction_, [this](i2c::ErrorCode err) { this->publish_measurement_(err); });
+  if (err != i2c::ERROR_OK)
+    this->publish_measurement_(err);
+}
 
-    // Evaluate and publish measurements
-    if (this->temp_sensor_ != nullptr) {
-      // Temp is contained in the first result word
-      float sensor_value_temp = buffer[0];
-      float temp = -45 + 175 * sensor_value_temp / 65535;
+void SHT4XComponent::publish_measurement_(i2c::ErrorCode err) {
+  uint16_t buffer[2];
 
-      this->temp_sensor_->publish_state(temp);
-    }
+  if (err != i2c::ERROR_OK || !this->decode_data(this->measurement_, buffer, 2)) {
+    // Using ESP_LOGW to force the warning to be printed
+    ESP_LOGW(TAG, "Sensor read failed");
+    this->status_set_warning();
+    return;
+  }
 
-    if (this->humidity_sensor_ != nullptr) {
-      // Relative humidity is in the second result word
-      float sensor_value_rh = buffer[1];
-      float rh = -6 + 125 * sensor_value_rh / 65535;
+  this->status_clear_warning();
 
-      this->humidity_sensor_->publish_state(rh);
-    }
-  });
+  // Evaluate and publish measurements
+  if (this->temp_sensor_ != nullptr) {
+    // Temp is contained in the first result word
+    float sensor_value_temp = buffer[0];
+    float temp = -45 + 175 * sensor_value_temp / 65535;
+
+    this->temp_sensor_->publish_state(temp);
+  }
+
+  if (this->humidity_sensor_ != nullptr) {
+    // Relative humidity is in the second result word
+    float sensor_value_rh = buffer[1];
+    float rh = -6 + 125 * sensor_value_rh / 65535;
+
+    this->humidity_sensor_->publish_state(rh);
+  }
 }
 
 }  // namespace sht4x
@@ -37,9 +37,16 @@ class SHT4XComponent : public PollingComponent, public sensirion_common::Sensiri
 
   void start_heater_();
   void read_serial_number_();
+  void read_measurement_();
+  void publish_measurement_(i2c::ErrorCode err);
   uint8_t heater_command_;
   uint32_t serial_number_;
 
+  i2c::I2CTransaction measure_transaction_;
+  i2c::I2CTransaction read_transaction_;
+  uint8_t measure_command_;
+  uint8_t measurement_[6];
+
   sensor::Sensor *temp_sensor_{nullptr};
   sensor::Sensor *humidity_sensor_{nullptr};
 };
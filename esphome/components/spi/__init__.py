@@ -85,6 +85,8 @@ CONF_FORCE_SW = "force_sw"
 CONF_INTERFACE = "interface"
 CONF_INTERFACE_INDEX = "interface_index"
 CONF_RELEASE_DEVICE = "release_device"
+CONF_SPI_PREEMPTIBLE = "spi_preemptible"
+CONF_SPI_PRIORITY = "spi_priority"
 TYPE_SINGLE = "single"
 TYPE_QUAD = "quad"
 TYPE_OCTAL = "octal"
@@ -399,6 +401,10 @@ def spi_device_schema(
             SPI_MODE_OPTIONS, upper=True
         ),
         cv.Optional(CONF_RELEASE_DEVICE): cv.All(cv.boolean, cv.only_with_esp_idf),
+        cv.Optional(CONF_SPI_PRIORITY): cv.All(
+            cv.int_range(min=0, max=7), cv.only_with_esp_idf
+        ),
+        cv.Optional(CONF_SPI_PREEMPTIBLE): cv.All(cv.boolean, cv.only_with_esp_idf),
     }
     if cs_pin_required:
         schema[cv.Required(CONF_CS_PIN)] = pins.gpio_output_pin_schema
@@ -419,6 +425,13 @@ async def register_spi_device(var, config):
         cg.add(var.set_mode(spi_mode))
     if release_device := config.get(CONF_RELEASE_DEVICE):
         cg.add(var.set_release_device(release_device))
+    if (priority := config.get(CONF_SPI_PRIORITY)) is not None:
+        cg.add(var.set_spi_priority(priority))
+    if preemptible := config.get(CONF_SPI_PREEMPTIBLE):
+        cg.add(var.set_spi_preemptible(preemptible))
+    if priority is not None or preemptible:
+        # Any device with a priority or that gives way switches all hardware buses to the queued delegate
+        cg.add_define("USE_SPI_QUEUE")
 
 
 def final_validate_device_schema(name: str, *, require_mosi: bool, require_miso: bool):
@@ -1,6 +1,7 @@
 #include "spi.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include <cinttypes>
 
 namespace esphome {
 namespace spi {
@@ -16,13 +17,14 @@ bool SPIDelegate::is_ready() { return true; }
 GPIOPin *const NullPin::NULL_PIN = new NullPin();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 SPIDelegate *SPIComponent::register_device(SPIClient *device, SPIMode mode, SPIBitOrder bit_order, uint32_t data_rate,
-                                           GPIOPin *cs_pin, bool release_device, bool write_only) {
+                                           GPIOPin *cs_pin, bool release_device, bool write_only, uint8_t priority,
+                                           bool preemptible) {
   if (this->devices_.count(device) != 0) {
     ESP_LOGE(TAG, "Device already registered");
     return this->devices_[device];
   }
-  SPIDelegate *delegate =
-      this->spi_bus_->get_delegate(data_rate, bit_order, mode, cs_pin, release_device, write_only);  // NOLINT
+  SPIDelegate *delegate = this->spi_bus_->get_delegate(data_rate, bit_order, mode, cs_pin, release_device, write_only,
+                                                       priority, preemptible);  // NOLINT
   this->devices_[device] = delegate;
   return delegate;
 }
@@ -34,6 +36,9 @@ void SPIComponent::unregister_device(SPIClient *device) {
   }
   delete this->devices_[device];  // NOLINT
   this->devices_.erase(device);
+#if defined(USE_SPI_QUEUE) && ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
+  this->last_stats_.erase(device);
+#endif
 }
 
 void SPIComponent::setup() {
@@ -61,8 +66,36 @@ void SPIComponent::setup() {
     this->sdo_pin_->setup();
     this->sdi_pin_->setup();
   }
+#if defined(USE_SPI_QUEUE) && ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
+  this->last_stats_time_ = millis();
+  this->set_interval(60000, [this]() { this->log_utilisation_(); });
+#endif
 }
 
+#if defined(USE_SPI_QUEUE) && ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
+void SPIComponent::log_utilisation_() {
+  const uint32_t now = millis();
+  const uint32_t elapsed_ms = now - this->last_stats_time_;
+  this->last_stats_time_ = now;
+  if (elapsed_ms == 0)
+    return;
+  for (const auto &[device, delegate] : this->devices_) {
+    const SPIDeviceStats *stats = delegate->get_stats();
+    if (stats == nullptr)
+      continue;
+    SPIDeviceStats &last = this->last_stats_[device];
+    ESP_LOGV(TAG,
+             "Device with CS %s: %.1f%% busy, %.1f%% waiting, %" PRIu32 " transactions, %" PRIu64 " bytes, %" PRIu32
+             " preemptions",
+             device->get_cs_pin() == nullptr ? "none" : device->get_cs_pin()->dump_summary().c_str(),
+             (stats->busy_us - last.busy_us) / (elapsed_ms * 10.0f),
+             (stats->wait_us - last.wait_us) / (elapsed_ms * 10.0f), stats->transactions - last.transactions,
+             stats->bytes - last.bytes, stats->preemptions - last.preemptions);
+    last = *stats;
+  }
+}
+#endif
+
 void SPIComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "SPI bus:");
   LOG_PIN("  CLK Pin: ", this->clk_pin_)
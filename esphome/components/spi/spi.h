@@ -171,6 +171,17 @@ class Utility {
 
 class SPIDelegateDummy;
 
+#ifdef USE_SPI_QUEUE
+/// Bus usage of one device, counted by the queued ESP-IDF delegate.
+struct SPIDeviceStats {
+  uint32_t transactions{0};  ///< begin/end transaction pairs
+  uint32_t preemptions{0};   ///< times a long transfer gave the bus to a more urgent device
+  uint64_t bytes{0};         ///< data bytes transferred
+  uint64_t busy_us{0};       ///< time the device held the bus
+  uint64_t wait_us{0};       ///< time spent waiting for other devices to release the bus
+};
+#endif
+
 // represents a device attached to an SPI bus, with a defined clock rate, mode and bit order. On Arduino this is
 // a thin wrapper over SPIClass.
 class SPIDelegate {
@@ -251,6 +262,11 @@ class SPIDelegate {
   // check if device is ready
   virtual bool is_ready();
 
+#ifdef USE_SPI_QUEUE
+  // bus usage counters, or nullptr if this delegate does not keep them
+  virtual const SPIDeviceStats *get_stats() const { return nullptr; }
+#endif
+
  protected:
   SPIBitOrder bit_order_{BIT_ORDER_MSB_FIRST};
   uint32_t data_rate_{1000000};
@@ -318,7 +334,7 @@ class SPIBus {
   SPIBus(GPIOPin *clk, GPIOPin *sdo, GPIOPin *sdi) : clk_pin_(clk), sdo_pin_(sdo), sdi_pin_(sdi) {}
 
   virtual SPIDelegate *get_delegate(uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin,
-                                    bool release_device, bool write_only) {
+                                    bool release_device, bool write_only, uint8_t priority, bool preemptible) {
     return new SPIDelegateBitBash(data_rate, bit_order, mode, cs_pin, this->clk_pin_, this->sdo_pin_, this->sdi_pin_);
   }
 
@@ -335,7 +351,8 @@ class SPIClient;
 class SPIComponent : public Component {
  public:
   SPIDelegate *register_device(SPIClient *device, SPIMode mode, SPIBitOrder bit_order, uint32_t data_rate,
-                               GPIOPin *cs_pin, bool release_device, bool write_only);
+                               GPIOPin *cs_pin, bool release_device, bool write_only, uint8_t priority,
+                               bool preemptible);
   void unregister_device(SPIClient *device);
 
   void set_clk(GPIOPin *clk) { this->clk_pin_ = clk; }
@@ -374,6 +391,12 @@ class SPIComponent : public Component {
   const char *interface_name_{nullptr};
   SPIBus *spi_bus_{};
   std::map<SPIClient *, SPIDelegate *> devices_;
+#if defined(USE_SPI_QUEUE) && ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
+  // Bus usage per device is logged once a minute, only with verbose logging
+  void log_utilisation_();
+  std::map<SPIClient *, SPIDeviceStats> last_stats_;
+  uint32_t last_stats_time_{0};
+#endif
 
   static SPIBus *get_bus(SPIInterface interface, GPIOPin *clk, GPIOPin *sdo, GPIOPin *sdi,
                          const std::vector<uint8_t> &data_pins);
@@ -392,7 +415,8 @@ class SPIClient {
   virtual void spi_setup() {
     esph_log_d("spi_device", "mode %u, data_rate %ukHz", (unsigned) this->mode_, (unsigned) (this->data_rate_ / 1000));
     this->delegate_ = this->parent_->register_device(this, this->mode_, this->bit_order_, this->data_rate_, this->cs_,
-                                                     this->release_device_, this->write_only_);
+                                                     this->release_device_, this->write_only_, this->spi_priority_,
+                                                     this->spi_preemptible_);
   }
 
   virtual void spi_teardown() {
@@ -403,6 +427,14 @@ class SPIClient {
   bool spi_is_ready() { return this->delegate_->is_ready(); }
   void set_release_device(bool release) { this->release_device_ = release; }
   void set_write_only(bool write_only) { this->write_only_ = write_only; }
+  /// Devices with a higher priority get the bus first, and interrupt long transfers of preemptible ones.
+  void set_spi_priority(uint8_t priority) { this->spi_priority_ = priority; }
+  /// Allow long transfers to release CS between chunks, so a more urgent device can use the bus in the middle of them.
+  void set_spi_preemptible(bool preemptible) { this->spi_preemptible_ = preemptible; }
+#ifdef USE_SPI_QUEUE
+  const SPIDeviceStats *get_spi_stats() const { return this->delegate_->get_stats(); }
+  GPIOPin *get_cs_pin() const { return this->cs_; }
+#endif
 
  protected:
   SPIBitOrder bit_order_{BIT_ORDER_MSB_FIRST};
@@ -412,6 +444,8 @@ class SPIClient {
   GPIOPin *cs_{nullptr};
   bool release_device_{false};
   bool write_only_{false};
+  uint8_t spi_priority_{0};
+  bool spi_preemptible_{false};
   SPIDelegate *delegate_{SPIDelegate::NULL_DELEGATE};
 };
 
@@ -87,7 +87,7 @@ class SPIBusHw : public SPIBus {
   }
 
   SPIDelegate *get_delegate(uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin,
-                            bool release_device, bool write_only) override {
+                            bool release_device, bool write_only, uint8_t priority, bool preemptible) override {
     return new SPIDelegateHw(this->channel_, data_rate, bit_order, mode, cs_pin);
   }
 
@@ -1,6 +1,12 @@
 #include "spi.h"
 #include <vector>
 
+#ifdef USE_SPI_QUEUE
+#include "spi_queue.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
 namespace esphome {
 namespace spi {
 
@@ -8,6 +14,38 @@ namespace spi {
 static const char *const TAG = "spi-esp-idf";
 static const size_t MAX_TRANSFER_SIZE = 4092;  // dictated by ESP-IDF API.
 
+#ifdef USE_SPI_QUEUE
+/**
+ * Decides which device gets the bus next. Devices announce their priority while they wait, so a device holding the
+ * bus for a long transfer can tell when a more urgent one is queued behind it and give way between chunks.
+ */
+class SPIBusArbiter {
+ public:
+  SPIBusArbiter() : lock_(xSemaphoreCreateMutex()) {}
+
+  void acquire(uint8_t priority) {
+    this->waiters_.add(priority);
+    while (true) {
+      xSemaphoreTake(this->lock_, portMAX_DELAY);
+      if (!this->waiters_.is_waiting_above(priority))
+        break;
+      // A more urgent device is queued behind us; let it go first
+      xSemaphoreGive(this->lock_);
+      vTaskDelay(1);
+    }
+    this->waiters_.remove(priority);
+  }
+
+  void release() { xSemaphoreGive(this->lock_); }
+
+  bool is_waiting_above(uint8_t priority) const { return this->waiters_.is_waiting_above(priority); }
+
+ protected:
+  SemaphoreHandle_t lock_;
+  SPIWaiters waiters_;
+};
+#endif
+
 class SPIDelegateHw : public SPIDelegate {
  public:
   SPIDelegateHw(SPIInterface channel, uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin,
@@ -20,14 +58,36 @@ class SPIDelegateHw : public SPIDelegate {
       add_device_();
   }
 
+#ifdef USE_SPI_QUEUE
+  SPIDelegateHw(SPIInterface channel, uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin,
+                bool release_device, bool write_only, SPIBusArbiter *arbiter, uint8_t priority, bool preemptible)
+      : SPIDelegate(data_rate, bit_order, mode, cs_pin),
+        channel_(channel),
+        release_device_(release_device),
+        write_only_(write_only),
+        arbiter_(arbiter),
+        priority_(std::min<uint8_t>(priority, SPI_PRIORITY_LEVELS - 1)),
+        preemptible_(preemptible) {
+    if (!this->release_device_)
+      add_device_();
+  }
+
+  const SPIDeviceStats *get_stats() const override { return &this->stats_; }
+#endif
+
   bool is_ready() override { return this->handle_ != nullptr; }
 
   void begin_transaction() override {
     if (this->release_device_)
       this->add_device_();
     if (this->is_ready()) {
+#ifdef USE_SPI_QUEUE
+      this->acquire_bus_();
+      this->stats_.transactions++;
+#else
       if (spi_device_acquire_bus(this->handle_, portMAX_DELAY) != ESP_OK)
         ESP_LOGE(TAG, "Failed to acquire SPI bus");
+#endif
       SPIDelegate::begin_transaction();
     } else {
       ESP_LOGW(TAG, "SPI device not ready, cannot begin transaction");
@@ -37,7 +97,11 @@ class SPIDelegateHw : public SPIDelegate {
   void end_transaction() override {
     if (this->is_ready()) {
       SPIDelegate::end_transaction();
+#ifdef USE_SPI_QUEUE
+      this->release_bus_();
+#else
       spi_device_release_bus(this->handle_);
+#endif
       if (this->release_device_) {
         spi_bus_remove_device(this->handle_);
         this->handle_ = nullptr;  // reset handle to indicate no device is registered
@@ -53,13 +117,19 @@ class SPIDelegateHw : public SPIDelegate {
 
   // do a transfer. either txbuf or rxbuf (but not both) may be null.
   // transfers above the maximum size will be split.
-  // TODO - make use of the queue for interrupt transfers to provide a (short) pipeline of blocks
-  // when splitting is required.
   void transfer(const uint8_t *txbuf, uint8_t *rxbuf, size_t length) override {
     if (rxbuf != nullptr && this->write_only_) {
       ESP_LOGE(TAG, "Attempted read from write-only channel");
       return;
     }
+#ifdef USE_SPI_QUEUE
+    this->stats_.bytes += length;
+    if (length > MAX_TRANSFER_SIZE) {
+      spi_transaction_ext_t desc = {};
+      this->transfer_chunks_(desc, txbuf, rxbuf, length);
+      return;
+    }
+#endif
     spi_transaction_t desc = {};
     desc.flags = 0;
     while (length != 0) {
@@ -129,6 +199,13 @@ class SPIDelegateHw : public SPIDelegate {
     desc.base.rxlength = 0;
     desc.base.cmd = cmd;
     desc.base.addr = address;
+#ifdef USE_SPI_QUEUE
+    this->stats_.bytes += length;
+    if (length > MAX_TRANSFER_SIZE) {
+      this->transfer_chunks_(desc, data, nullptr, length);
+      return;
+    }
+#endif
     do {
       size_t chunk_size = std::min(length, MAX_TRANSFER_SIZE);
       if (data != nullptr && chunk_size != 0) {
@@ -191,7 +268,11 @@ class SPIDelegateHw : public SPIDelegate {
     config.clock_speed_hz = static_cast<int>(this->data_rate_);
     config.spics_io_num = -1;
     config.flags = 0;
+#ifdef USE_SPI_QUEUE
+    config.queue_size = 2;
+#else
     config.queue_size = 1;
+#endif
     config.pre_cb = nullptr;
     config.post_cb = nullptr;
     if (this->bit_order_ == BIT_ORDER_LSB_FIRST)
@@ -206,10 +287,95 @@ class SPIDelegateHw : public SPIDelegate {
     return true;
   }
 
+#ifdef USE_SPI_QUEUE
+  void acquire_bus_() {
+    const uint32_t start = micros();
+    this->arbiter_->acquire(this->priority_);
+    if (spi_device_acquire_bus(this->handle_, portMAX_DELAY) != ESP_OK)
+      ESP_LOGE(TAG, "Failed to acquire SPI bus");
+    this->acquired_at_ = micros();
+    this->stats_.wait_us += this->acquired_at_ - start;
+  }
+
+  void release_bus_() {
+    spi_device_release_bus(this->handle_);
+    this->arbiter_->release();
+    this->stats_.busy_us += micros() - this->acquired_at_;
+  }
+
+  /**
+   * Transfer data that needs several chunks through the interrupt queue, keeping the next chunk queued while the
+   * previous one is on the wire so the DMA does not idle between them. On a preemptible device, a more urgent device
+   * that is waiting stops the queueing; once the chunks in flight are done, the bus is handed over with CS released,
+   * and the transfer resumes when it is returned.
+   * @param desc Descriptor for the first chunk, including any command and address phases
+   */
+  void transfer_chunks_(spi_transaction_ext_t desc, const uint8_t *txbuf, uint8_t *rxbuf, size_t length) {
+    spi_transaction_ext_t descs[2];
+    uint8_t next = 0;
+    SPIChunkPipeline pipeline(length, MAX_TRANSFER_SIZE, 2, this->preemptible_);
+    while (true) {
+      switch (pipeline.next(this->arbiter_->is_waiting_above(this->priority_))) {
+        case SPIChunkPipeline::STEP_QUEUE: {
+          size_t const partial = pipeline.queue();
+          descs[next] = desc;
+          descs[next].base.length = partial * 8;
+          descs[next].base.rxlength = rxbuf == nullptr ? 0 : partial * 8;
+          descs[next].base.tx_buffer = txbuf;
+          descs[next].base.rx_buffer = rxbuf;
+          esp_err_t err = spi_device_queue_trans(this->handle_, &descs[next].base, portMAX_DELAY);
+          if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Transmit failed - err %X", err);
+            pipeline.collected();
+            pipeline.abort();
+            break;
+          }
+          next ^= 1;
+          // only the first chunk carries the command and address phases
+          desc.command_bits = 0;
+          desc.address_bits = 0;
+          if (txbuf != nullptr)
+            txbuf += partial;
+          if (rxbuf != nullptr)
+            rxbuf += partial;
+          break;
+        }
+        case SPIChunkPipeline::STEP_COLLECT: {
+          spi_transaction_t *done;
+          if (spi_device_get_trans_result(this->handle_, &done, portMAX_DELAY) != ESP_OK) {
+            ESP_LOGE(TAG, "Transmit failed");
+            return;
+          }
+          pipeline.collected();
+          break;
+        }
+        case SPIChunkPipeline::STEP_YIELD:
+          this->stats_.preemptions++;
+          this->cs_pin_->digital_write(true);
+          this->release_bus_();
+          this->acquire_bus_();
+          this->cs_pin_->digital_write(false);
+          pipeline.resumed();
+          break;
+        case SPIChunkPipeline::STEP_DONE:
+          return;
+      }
+    }
+  }
+#endif
+
   SPIInterface channel_{};
   spi_device_handle_t handle_{};
   bool release_device_{false};
   bool write_only_{false};
+#ifdef USE_SPI_QUEUE
+  SPIBusArbiter *arbiter_{nullptr};
+  uint8_t priority_{0};
+  /// Long transfers may release CS between chunks to let a more urgent device use the bus
+  bool preemptible_{false};
+  uint32_t acquired_at_{0};
+  SPIDeviceStats stats_{};
+#endif
 };
 
 class SPIBusHw : public SPIBus {
@@ -250,13 +416,22 @@ class SPIBusHw : public SPIBus {
   }
 
   SPIDelegate *get_delegate(uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin,
-                            bool release_device, bool write_only) override {
+                            bool release_device, bool write_only, uint8_t priority, bool preemptible) override {
+#ifdef USE_SPI_QUEUE
+    return new SPIDelegateHw(this->channel_, data_rate, bit_order, mode, cs_pin, release_device,
+                             write_only || Utility::get_pin_no(this->sdi_pin_) == -1, &this->arbiter_, priority,
+                             preemptible);
+#else
     return new SPIDelegateHw(this->channel_, data_rate, bit_order, mode, cs_pin, release_device,
                              write_only || Utility::get_pin_no(this->sdi_pin_) == -1);
+#endif
   }
 
  protected:
   SPIInterface channel_{};
+#ifdef USE_SPI_QUEUE
+  SPIBusArbiter arbiter_;
+#endif
 
   bool is_hw() override { return true; }
 };
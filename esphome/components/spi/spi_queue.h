@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace spi {
+
+/// Number of distinct device priorities on a queued bus
+static constexpr uint8_t SPI_PRIORITY_LEVELS = 8;
+
+/// Counts the devices waiting for a bus at each priority, so the owner can tell when a more urgent one is queued.
+class SPIWaiters {
+ public:
+  void add(uint8_t priority) { this->waiting_[priority]++; }
+  void remove(uint8_t priority) { this->waiting_[priority]--; }
+
+  bool is_waiting_above(uint8_t priority) const {
+    for (uint8_t i = priority + 1; i < SPI_PRIORITY_LEVELS; i++) {
+      if (this->waiting_[i].load(std::memory_order_relaxed) != 0)
+        return true;
+    }
+    return false;
+  }
+
+ protected:
+  std::atomic<uint8_t> waiting_[SPI_PRIORITY_LEVELS]{};
+};
+
+/**
+ * Steps through a transfer that is split into chunks, keeping up to `depth` of them queued. Once a more urgent device
+ * is waiting, no further chunk is queued: the ones in flight are collected, then the bus is handed over, and queueing
+ * resumes after resumed(). Only preemptible transfers give way, as the device sees CS rise in the middle of them.
+ */
+class SPIChunkPipeline {
+ public:
+  enum Step : uint8_t {
+    STEP_QUEUE,    ///< queue the next chunk, of queue() bytes
+    STEP_COLLECT,  ///< wait for the oldest chunk in flight, then call collected()
+    STEP_YIELD,    ///< nothing is in flight; hand the bus over, then call resumed()
+    STEP_DONE,
+  };
+
+  SPIChunkPipeline(size_t length, size_t chunk_size, uint8_t depth, bool preemptible)
+      : remaining_(length), chunk_size_(chunk_size), depth_(depth), preemptible_(preemptible) {}
+
+  /// What to do next; `yield_requested` tells whether a more urgent device is waiting for the bus.
+  Step next(bool yield_requested) {
+    if (yield_requested && this->preemptible_ && this->remaining_ != 0)
+      this->yielding_ = true;
+    if (this->yielding_)
+      return this->in_flight_ != 0 ? STEP_COLLECT : STEP_YIELD;
+    if (this->remaining_ != 0 && this->in_flight_ < this->depth_)
+      return STEP_QUEUE;
+    return this->in_flight_ != 0 ? STEP_COLLECT : STEP_DONE;
+  }
+
+  /// Take the next chunk off the remaining data and count it as in flight; returns its length.
+  size_t queue() {
+    const size_t chunk = std::min(this->remaining_, this->chunk_size_);
+    this->remaining_ -= chunk;
+    this->in_flight_++;
+    return chunk;
+  }
+  void collected() { this->in_flight_--; }
+  void resumed() { this->yielding_ = false; }
+  /// Queue nothing more after an error; the chunks in flight are still collected.
+  void abort() {
+    this->remaining_ = 0;
+    this->yielding_ = false;
+  }
+
+  size_t get_remaining() const { return this->remaining_; }
+  uint8_t get_in_flight() const { return this->in_flight_; }
+
+ protected:
+  size_t remaining_;
+  size_t chunk_size_;
+  uint8_t depth_;
+  uint8_t in_flight_{0};
+  bool preemptible_;
+  bool yielding_{false};
+};
+
+}  // namespace spi
+}  // namespace esphome
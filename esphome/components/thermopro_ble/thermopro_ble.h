@@ -21,6 +21,9 @@ class ThermoProBLE : public Component, public esp32_ble_tracker::ESPBTDeviceList
  public:
   void set_address(uint64_t address) { this->address_ = address; };
 
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override {
+    return advertisement.address_uint64() == this->address_;
+  }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   void dump_config() override;
   void set_signal_strength(sensor::Sensor *signal_strength) { this->signal_strength_ = signal_strength; }
@@ -45,6 +45,10 @@ class UARTDevice {
 
   int available() { return this->parent_->available(); }
 
+  size_t read_available(std::span<uint8_t> buffer) { return this->parent_->read_available(buffer); }
+
+  bool register_rx_listener(Component *listener) { return this->parent_->register_rx_listener(listener); }
+
   void flush() { this->parent_->flush(); }
 
   // Compat APIs
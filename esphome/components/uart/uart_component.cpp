@@ -19,6 +19,16 @@ bool UARTComponent::check_read_timeout_(size_t len) {
   return true;
 }
 
+size_t UARTComponent::read_available(std::span<uint8_t> buffer) {
+  int available = this->available();
+  if (available <= 0 || buffer.empty())
+    return 0;
+  size_t len = std::min<size_t>(available, buffer.size());
+  if (!this->read_array(buffer.data(), len))
+    return 0;
+  return len;
+}
+
 void UARTComponent::set_rx_full_threshold_ms(uint8_t time) {
   uint8_t bytelength = this->data_bits_ + this->stop_bits_ + 1;
   if (this->parity_ != UARTParityOptions::UART_CONFIG_PARITY_NONE)
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <cstring>
+#include <span>
 #include "esphome/core/defines.h"
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
@@ -71,6 +72,18 @@ class UARTComponent {
   // @return Number of available bytes.
   virtual int available() = 0;
 
+  // Reads the bytes that are already buffered, up to the size of the buffer, without waiting for more.
+  // Replaces polling available() and reading byte by byte with one bulk read per loop.
+  // @param buffer Buffer where the read data will be stored.
+  // @return Number of bytes read.
+  virtual size_t read_available(std::span<uint8_t> buffer);
+
+  // Registers a component to be woken with enable_loop_soon_any_context() whenever data or an RX timeout (frame gap)
+  // arrives. A listener may then disable its loop while there is nothing to read.
+  // @param listener Component to notify.
+  // @return True if this bus will notify the listener, false if it can't and the listener must keep polling.
+  virtual bool register_rx_listener(Component *listener) { return false; }
+
   // Pure virtual method to block until all bytes have been written to the UART bus.
   virtual void flush() = 0;
 
@@ -343,6 +343,35 @@ int IDFUARTComponent::available() {
   return available;
 }
 
+size_t IDFUARTComponent::read_available(std::span<uint8_t> buffer) {
+  if (buffer.empty())
+    return 0;
+  uint8_t *data = buffer.data();
+  size_t len = 0;
+
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  if (this->has_peek_) {
+    *data = this->peek_byte_;
+    this->has_peek_ = false;
+    len = 1;
+  }
+  size_t buffered = 0;
+  if ((len < buffer.size()) && (uart_get_buffered_data_len(this->uart_num_, &buffered) == ESP_OK) && (buffered > 0)) {
+    // Only what is already in the ring buffer is read, so this never blocks
+    int read_len = uart_read_bytes(this->uart_num_, data + len, std::min(buffered, buffer.size() - len), 0);
+    if (read_len > 0)
+      len += read_len;
+  }
+  xSemaphoreGive(this->lock_);
+
+#ifdef USE_UART_DEBUGGER
+  for (size_t i = 0; i < len; i++) {
+    this->debug_callback_.call(UART_DIRECTION_RX, data[i]);
+  }
+#endif
+  return len;
+}
+
 void IDFUARTComponent::flush() {
   ESP_LOGVV(TAG, "    Flushing");
   xSemaphoreTake(this->lock_, portMAX_DELAY);
@@ -353,6 +382,22 @@ void IDFUARTComponent::flush() {
 void IDFUARTComponent::check_logger_conflict() {}
 
 #ifdef USE_UART_WAKE_LOOP_ON_RX
+bool IDFUARTComponent::register_rx_listener(Component *listener) {
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  this->rx_listeners_.push_back(listener);
+  xSemaphoreGive(this->lock_);
+  return true;
+}
+
+void IDFUARTComponent::notify_rx_listeners_() {
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  for (auto *listener : this->rx_listeners_) {
+    listener->enable_loop_soon_any_context();
+  }
+  xSemaphoreGive(this->lock_);
+  App.wake_loop_threadsafe();
+}
+
 void IDFUARTComponent::start_rx_event_task_() {
   // Create FreeRTOS task to monitor UART events
   BaseType_t result = xTaskCreate(rx_event_task_func,    // Task function
@@ -383,16 +428,16 @@ void IDFUARTComponent::rx_event_task_func(void *param) {
     if (xQueueReceive(self->uart_event_queue_, &event, portMAX_DELAY) == pdTRUE) {
       switch (event.type) {
         case UART_DATA:
-          // Data available in UART RX buffer - wake the main loop
+          // Data available in UART RX buffer (RX full threshold or RX timeout) - wake the listeners and the main loop
           ESP_LOGVV(TAG, "Data event: %d bytes", event.size);
-          App.wake_loop_threadsafe();
+          self->notify_rx_listeners_();
           break;
 
         case UART_FIFO_OVF:
         case UART_BUFFER_FULL:
           ESP_LOGW(TAG, "FIFO overflow or ring buffer full - clearing");
           uart_flush_input(self->uart_num_);
-          App.wake_loop_threadsafe();
+          self->notify_rx_listeners_();
           break;
 
         default:
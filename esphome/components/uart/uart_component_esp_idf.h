@@ -23,8 +23,13 @@ class IDFUARTComponent : public UARTComponent, public Component {
   bool read_array(uint8_t *data, size_t len) override;
 
   int available() override;
+  size_t read_available(std::span<uint8_t> buffer) override;
   void flush() override;
 
+#ifdef USE_UART_WAKE_LOOP_ON_RX
+  bool register_rx_listener(Component *listener) override;
+#endif
+
   uint8_t get_hw_serial_number() { return this->uart_num_; }
   QueueHandle_t *get_uart_event_queue() { return &this->uart_event_queue_; }
 
@@ -56,9 +61,12 @@ class IDFUARTComponent : public UARTComponent, public Component {
 #ifdef USE_UART_WAKE_LOOP_ON_RX
   // RX notification support
   void start_rx_event_task_();
+  void notify_rx_listeners_();
   static void rx_event_task_func(void *param);
 
   TaskHandle_t rx_event_task_handle_{nullptr};
+  // Components re-enabled by the RX event task; guarded by lock_
+  std::vector<Component *> rx_listeners_;
 #endif  // USE_UART_WAKE_LOOP_ON_RX
 };
 
@@ -156,7 +156,7 @@ void DeferredUpdateEventSource::loop() {
 }
 
 void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *event_type,
-                                                      message_generator_t *message_generator) {
+                                                      message_generator_t *message_generator, std::string &message) {
   // Skip if no connected clients to avoid unnecessary deferred queue processing
   if (this->count() == 0)
     return;
@@ -183,7 +183,8 @@ void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *
     // deferred queue still not empty which means downstream event queue full, no point trying to send first
     deq_push_back_with_dedup_(source, message_generator);
   } else {
-    std::string message = message_generator(web_server_, source);
+    if (message.empty())
+      message = message_generator(web_server_, source);
     if (this->send(message.c_str(), "state") == DISCARDED) {
       deq_push_back_with_dedup_(source, message_generator);
     } else {
@@ -209,8 +210,10 @@ void DeferredUpdateEventSourceList::deferrable_send_state(void *source, const ch
   // Skip if no event sources (no connected clients) to avoid unnecessary iteration
   if (this->empty())
     return;
+  // Generated lazily by the first client that can send right away, then reused by the others
+  std::string message;
   for (DeferredUpdateEventSource *dues : *this) {
-    dues->deferrable_send_state(source, event_type, message_generator);
+    dues->deferrable_send_state(source, event_type, message_generator, message);
   }
 }
 
@@ -434,6 +437,38 @@ static void set_json_icon_state_value(JsonObject &root, EntityBase *obj, const c
   root[ESPHOME_F("state")] = state;
 }
 
+// Fits "binary_sensor-" + a 128 char object_id + value + a typical state, longer events fall back to ArduinoJson
+static constexpr size_t STATE_JSON_BUFFER_SIZE = 256;
+
+void WebServer::write_json_id_(json::JsonWriter &writer, EntityBase *obj, const char *prefix) {
+  writer.begin_string("id");
+  writer.append_string(prefix);
+  writer.append_string("-", 1);
+  StringRef object_id = obj->get_object_id_ref_for_api_();
+  if (!object_id.empty()) {
+    writer.append_string(object_id.c_str(), object_id.size());
+  } else {
+    // Dynamic object_id (name_add_mac_suffix), rare
+    const auto dynamic_id = obj->get_object_id();
+    writer.append_string(dynamic_id.data(), dynamic_id.size());
+  }
+  writer.end_string();
+}
+
+template<typename T>
+std::string WebServer::state_event_json_(EntityBase *obj, const char *prefix, const T &value, const char *state,
+                                         size_t state_len) {
+  json::StaticJsonWriter<STATE_JSON_BUFFER_SIZE> writer;
+  writer.begin_object();
+  write_json_id_(writer, obj, prefix);
+  writer.add("value", value);
+  writer.add("state", state, state_len);
+  writer.end_object();
+  if (writer.overflowed())
+    return {};
+  return std::string(writer.c_str(), writer.size());
+}
+
 // Helper to get request detail parameter
 static JsonDetail get_request_detail(AsyncWebServerRequest *request) {
   auto *param = request->getParam("detail");
@@ -461,7 +496,19 @@ void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 std::string WebServer::sensor_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->sensor_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, DETAIL_STATE);
+  auto *obj = (sensor::Sensor *) (source);
+  char state[64];
+  size_t state_len;
+  if (std::isnan(obj->state)) {
+    state_len = snprintf(state, sizeof(state), "NA");
+  } else {
+    state_len = value_accuracy_with_uom_to_buf(state, sizeof(state), obj->state, obj->get_accuracy_decimals(),
+                                               obj->get_unit_of_measurement_ref());
+  }
+  std::string message = state_event_json_(obj, "sensor", obj->state, state, state_len);
+  if (message.empty())
+    return web_server->sensor_json(obj, obj->state, DETAIL_STATE);
+  return message;
 }
 std::string WebServer::sensor_all_json_generator(WebServer *web_server, void *source) {
   return web_server->sensor_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, DETAIL_ALL);
@@ -506,8 +553,11 @@ void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const
   request->send(404);
 }
 std::string WebServer::text_sensor_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->text_sensor_json((text_sensor::TextSensor *) (source),
-                                      ((text_sensor::TextSensor *) (source))->state, DETAIL_STATE);
+  auto *obj = (text_sensor::TextSensor *) (source);
+  std::string message = state_event_json_(obj, "text_sensor", obj->state, obj->state.data(), obj->state.size());
+  if (message.empty())
+    return web_server->text_sensor_json(obj, obj->state, DETAIL_STATE);
+  return message;
 }
 std::string WebServer::text_sensor_all_json_generator(WebServer *web_server, void *source) {
   return web_server->text_sensor_json((text_sensor::TextSensor *) (source),
@@ -582,7 +632,11 @@ void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 std::string WebServer::switch_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_STATE);
+  auto *obj = (switch_::Switch *) (source);
+  std::string message = state_event_json_(obj, "switch", obj->state, obj->state ? "ON" : "OFF", obj->state ? 2 : 3);
+  if (message.empty())
+    return web_server->switch_json(obj, obj->state, DETAIL_STATE);
+  return message;
 }
 std::string WebServer::switch_all_json_generator(WebServer *web_server, void *source) {
   return web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_ALL);
@@ -661,8 +715,12 @@ void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, con
   request->send(404);
 }
 std::string WebServer::binary_sensor_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->binary_sensor_json((binary_sensor::BinarySensor *) (source),
-                                        ((binary_sensor::BinarySensor *) (source))->state, DETAIL_STATE);
+  auto *obj = (binary_sensor::BinarySensor *) (source);
+  std::string message =
+      state_event_json_(obj, "binary_sensor", obj->state, obj->state ? "ON" : "OFF", obj->state ? 2 : 3);
+  if (message.empty())
+    return web_server->binary_sensor_json(obj, obj->state, DETAIL_STATE);
+  return message;
 }
 std::string WebServer::binary_sensor_all_json_generator(WebServer *web_server, void *source) {
   return web_server->binary_sensor_json((binary_sensor::BinarySensor *) (source),
@@ -4,6 +4,7 @@
 
 #include "esphome/components/web_server_base/web_server_base.h"
 #ifdef USE_WEBSERVER
+#include "esphome/components/json/json_writer.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
@@ -145,7 +146,10 @@ class DeferredUpdateEventSource : public AsyncEventSource {
 
   void loop();
 
-  void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator);
+  /// Send a state event, generating it into `message` only if it is still empty. This lets
+  /// DeferredUpdateEventSourceList build each event once and share it across all clients that can send immediately.
+  void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator,
+                             std::string &message);
   void try_send_nodefer(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
 };
 
@@ -520,6 +524,13 @@ class WebServer : public Controller,
  protected:
   void add_sorting_info_(JsonObject &root, EntityBase *entity);
 
+  /// Serialize a DETAIL_STATE event ({"id","value","state"}) with the allocation-free JsonWriter. This is the hot
+  /// path for SSE state events; returns an empty string if the buffer overflowed so callers can fall back.
+  template<typename T>
+  static std::string state_event_json_(EntityBase *obj, const char *prefix, const T &value, const char *state,
+                                       size_t state_len);
+  static void write_json_id_(json::JsonWriter &writer, EntityBase *obj, const char *prefix);
+
 #ifdef USE_LIGHT
   // Helper to parse and apply a float parameter with optional scaling
   template<typename T, typename Ret>
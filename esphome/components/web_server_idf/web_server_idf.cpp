@@ -292,6 +292,9 @@ void AsyncWebServerRequest::init_response_(AsyncWebServerResponse *rsp, int code
     case 200:
       status = HTTPD_200;
       break;
+    case 304:
+      status = "304 Not Modified";
+      break;
     case 404:
       status = HTTPD_404;
       break;
@@ -464,9 +467,11 @@ void AsyncEventSource::deferrable_send_state(void *source, const char *event_typ
   // Skip if no connected clients to avoid unnecessary processing
   if (this->empty())
     return;
+  // Generated lazily by the first session that can send right away, then reused by the others
+  std::string message;
   for (auto *ses : this->sessions_) {
     if (ses->fd_.load() != 0) {  // Skip dead sessions
-      ses->deferrable_send_state(source, event_type, message_generator);
+      ses->deferrable_send_state(source, event_type, message_generator, message);
     }
   }
 }
@@ -765,7 +770,7 @@ bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char
 }
 
 void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *event_type,
-                                                     message_generator_t *message_generator) {
+                                                     message_generator_t *message_generator, std::string &message) {
   // allow all json "details_all" to go through before publishing bare state events, this avoids unnamed entries showing
   // up in the web GUI and reduces event load during initial connect
   if (!entities_iterator_->completed() && 0 != strcmp(event_type, "state_detail_all"))
@@ -790,7 +795,8 @@ void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *e
     // trying to send first
     deq_push_back_with_dedup_(source, message_generator);
   } else {
-    std::string message = message_generator(web_server_, source);
+    if (message.empty())
+      message = message_generator(web_server_, source);
     if (!this->try_send_nodefer(message.c_str(), "state")) {
       deq_push_back_with_dedup_(source, message_generator);
     }
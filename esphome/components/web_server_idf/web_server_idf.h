@@ -267,7 +267,10 @@ class AsyncEventSourceResponse {
 
  public:
   bool try_send_nodefer(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
-  void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator);
+  /// Send a state event, generating it into `message` only if it is still empty. This lets AsyncEventSource build
+  /// each event once and share it across all sessions that can send immediately.
+  void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator,
+                             std::string &message);
   void loop();
 
  protected:
@@ -75,6 +75,8 @@ bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std:
 
 class XiaomiListener : public esp32_ble_tracker::ESPBTDeviceListener {
  public:
+  // Each sensor parses its own advertisements, this listener never uses them
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override { return false; }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 };
 
@@ -18,6 +18,9 @@ class XiaomiCGPR1 : public Component,
   void set_address(uint64_t address) { address_ = address; }
   void set_bindkey(const std::string &bindkey);
 
+  bool accepts_advertisement(const esp32_ble_tracker::ESPBTAdvertisement &advertisement) override {
+    return advertisement.address_uint64() == this->address_;
+  }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 
   void dump_config() override;
@@ -19,8 +19,13 @@ class APIConnection;
 
 namespace web_server {
 struct UrlMatch;
+class WebServer;
 }  // namespace web_server
 
+namespace prometheus {
+class PrometheusHandler;
+}  // namespace prometheus
+
 enum EntityCategory : uint8_t {
   ENTITY_CATEGORY_NONE = 0,
   ENTITY_CATEGORY_CONFIG = 1,
@@ -127,6 +132,8 @@ class EntityBase {
  protected:
   friend class api::APIConnection;
   friend struct web_server::UrlMatch;
+  friend class web_server::WebServer;
+  friend class prometheus::PrometheusHandler;
 
   // Get object_id as StringRef when it's static (for API usage)
   // Returns empty StringRef if object_id is dynamic (needs allocation)
@@ -386,16 +386,27 @@ std::string value_accuracy_to_string(float value, int8_t accuracy_decimals) {
 }
 
 std::string value_accuracy_with_uom_to_string(float value, int8_t accuracy_decimals, StringRef unit_of_measurement) {
-  normalize_accuracy_decimals(value, accuracy_decimals);
   // Buffer sized for float (up to ~15 chars) + space + typical UOM (usually <20 chars like "μS/cm")
   // snprintf truncates safely if exceeded, though ESPHome UOMs are typically short
   char tmp[64];
+  size_t len = value_accuracy_with_uom_to_buf(tmp, sizeof(tmp), value, accuracy_decimals, unit_of_measurement);
+  return std::string(tmp, len);
+}
+
+size_t value_accuracy_with_uom_to_buf(char *buf, size_t buf_len, float value, int8_t accuracy_decimals,
+                                      StringRef unit_of_measurement) {
+  if (buf_len == 0)
+    return 0;
+  normalize_accuracy_decimals(value, accuracy_decimals);
+  int len;
   if (unit_of_measurement.empty()) {
-    snprintf(tmp, sizeof(tmp), "%.*f", accuracy_decimals, value);
+    len = snprintf(buf, buf_len, "%.*f", accuracy_decimals, value);
   } else {
-    snprintf(tmp, sizeof(tmp), "%.*f %s", accuracy_decimals, value, unit_of_measurement.c_str());
+    len = snprintf(buf, buf_len, "%.*f %s", accuracy_decimals, value, unit_of_measurement.c_str());
   }
-  return std::string(tmp);
+  if (len < 0)
+    return 0;
+  return std::min(static_cast<size_t>(len), buf_len - 1);
 }
 
 int8_t step_to_accuracy_decimals(float step) {
@@ -846,6 +846,10 @@ ParseOnOffState parse_on_off(const char *str, const char *on = nullptr, const ch
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals);
 /// Create a string from a value, an accuracy in decimals, and a unit of measurement.
 std::string value_accuracy_with_uom_to_string(float value, int8_t accuracy_decimals, StringRef unit_of_measurement);
+/// Format a value, an accuracy in decimals, and a unit of measurement into a buffer. Returns the formatted length
+/// (truncated to fit, excluding the null terminator).
+size_t value_accuracy_with_uom_to_buf(char *buf, size_t buf_len, float value, int8_t accuracy_decimals,
+                                      StringRef unit_of_measurement);
 
 /// Derive accuracy in decimals from an increment step.
 int8_t step_to_accuracy_decimals(float step);
@@ -12,3 +12,24 @@ def test_sensor_device_class_set(generate_main):
 
     # Then
     assert 's_1->set_device_class("voltage");' in main_cpp
+
+
+def test_sensor_filters_fused(generate_main):
+    """
+    Consecutive stateless arithmetic filters should be fused into one lambda filter,
+    while stateful filters and the branches of an or filter stay separate
+    """
+    # Given
+
+    # When
+    main_cpp = generate_main("tests/component_tests/sensor/test_sensor.yaml")
+
+    # Then
+    assert "new sensor::StatelessLambdaFilter([](float x) -> optional<float> {" in main_cpp
+    assert "// fused: multiply, offset, clamp, round" in main_cpp
+    assert "x = x * 2.0f;" in main_cpp
+    assert "if (std::isfinite(x) && x > 100.0f) x = 100.0f;" in main_cpp
+    assert "new sensor::DeltaFilter(" in main_cpp
+    # A single stateless filter is not worth fusing
+    assert "new sensor::OffsetFilter(1.0f);" in main_cpp
+    assert "new sensor::MultiplyFilter(2.0f);" in main_cpp
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "esphome/components/audio/audio.h"
+
+namespace esphome::audio::testing {
+
+// Per-sample reference implementations, as previously written in audio.cpp and the mixer speaker; the block kernels
+// must match them exactly.
+
+static int16_t reference_scale(int16_t sample, int16_t scale_factor) {
+  int32_t acc = (int32_t) sample * (int32_t) scale_factor;
+  return (int16_t) (acc >> 15);
+}
+
+static int16_t reference_add(int16_t first, int16_t second) {
+  int32_t sum = (int32_t) first + (int32_t) second;
+  if (sum > INT16_MAX)
+    return INT16_MAX;
+  if (sum < INT16_MIN)
+    return INT16_MIN;
+  return sum;
+}
+
+static std::vector<int16_t> random_samples(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(INT16_MIN, INT16_MAX);
+  std::vector<int16_t> samples(count);
+  for (auto &sample : samples)
+    sample = dist(rng);
+  // Make sure the extremes are always covered
+  samples[0] = INT16_MIN;
+  samples[1] = INT16_MAX;
+  return samples;
+}
+
+TEST(AudioSamplesTest, ScaleMatchesReference) {
+  // Odd length covers a tail shorter than the unrolled step
+  const auto samples = random_samples(1027, 1);
+  for (int16_t scale_factor : {(int16_t) 0, (int16_t) 1, (int16_t) 16384, (int16_t) 32767, (int16_t) -1,
+                               (int16_t) -32768, (int16_t) 1234}) {
+    std::vector<int16_t> output(samples.size());
+    scale_audio_samples(samples.data(), output.data(), scale_factor, samples.size());
+    for (size_t i = 0; i != samples.size(); i++) {
+      ASSERT_EQ(output[i], reference_scale(samples[i], scale_factor)) << "sample " << i << " scale " << scale_factor;
+    }
+  }
+}
+
+TEST(AudioSamplesTest, ScaleInPlace) {
+  auto samples = random_samples(100, 2);
+  const auto original = samples;
+  scale_audio_samples(samples.data(), samples.data(), 20000, samples.size());
+  for (size_t i = 0; i != samples.size(); i++)
+    EXPECT_EQ(samples[i], reference_scale(original[i], 20000)) << "sample " << i;
+}
+
+TEST(AudioSamplesTest, AddMatchesReference) {
+  const auto first = random_samples(1029, 3);
+  const auto second = random_samples(1029, 4);
+  std::vector<int16_t> output(first.size());
+  add_audio_samples(first.data(), second.data(), output.data(), first.size());
+  for (size_t i = 0; i != first.size(); i++)
+    ASSERT_EQ(output[i], reference_add(first[i], second[i])) << "sample " << i;
+}
+
+TEST(AudioSamplesTest, AddSaturates) {
+  const int16_t first[] = {INT16_MAX, INT16_MIN, 30000, -30000, 100, -100, 0, 1, INT16_MAX};
+  const int16_t second[] = {1, -1, 30000, -30000, -100, 100, 0, -1, INT16_MIN};
+  const int16_t expected[] = {INT16_MAX, INT16_MIN, INT16_MAX, INT16_MIN, 0, 0, 0, 0, -1};
+  int16_t output[9];
+  add_audio_samples(first, second, output, 9);
+  for (size_t i = 0; i != 9; i++)
+    EXPECT_EQ(output[i], expected[i]) << "sample " << i;
+}
+
+TEST(AudioSamplesTest, AddInPlace) {
+  auto mixed = random_samples(64, 5);
+  const auto original = mixed;
+  const auto other = random_samples(64, 6);
+  add_audio_samples(mixed.data(), other.data(), mixed.data(), mixed.size());
+  for (size_t i = 0; i != mixed.size(); i++)
+    EXPECT_EQ(mixed[i], reference_add(original[i], other[i])) << "sample " << i;
+}
+
+}  // namespace esphome::audio::testing
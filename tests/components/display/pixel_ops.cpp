@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "esphome/components/display/display.h"
+#include "esphome/components/display/pixel_ops.h"
+
+namespace esphome::display::testing {
+
+using namespace pixel_ops;
+
+// Per-pixel conversions as previously written out in the display drivers; the kernels must match them exactly.
+
+static void reference_rgb565_to_rgb666(uint8_t *dst, uint16_t color_val, bool big_endian) {
+  if (big_endian) {
+    dst[0] = color_val & 0xF8;
+    dst[1] = ((color_val & 0x7) << 5) | (color_val & 0xE000) >> 11;
+    dst[2] = (color_val >> 5) & 0xF8;
+  } else {
+    dst[0] = (color_val >> 8) & 0xF8;
+    dst[1] = (color_val & 0x7E0) >> 3;
+    dst[2] = color_val << 3;
+  }
+}
+
+static uint16_t reference_color_to_rgb565(Color color, bool big_endian) {
+  if (big_endian)
+    return (color.r & 0xF8) | color.g >> 5 | (color.g & 0x1C) << 11 | (color.b & 0xF8) << 5;
+  return (color.r & 0xF8) << 8 | (color.g & 0xFC) << 3 | color.b >> 3;
+}
+
+TEST(PixelOpsTest, ColorToRgb565) {
+  EXPECT_EQ(color_to_rgb565(Color(0xFF, 0x00, 0x00), false), 0xF800);
+  EXPECT_EQ(color_to_rgb565(Color(0x00, 0xFF, 0x00), false), 0x07E0);
+  EXPECT_EQ(color_to_rgb565(Color(0x00, 0x00, 0xFF), false), 0x001F);
+  EXPECT_EQ(color_to_rgb565(Color(0xFF, 0x00, 0x00), true), 0x00F8);
+  for (int v = 0; v != 256; v++) {
+    Color color(v, 255 - v, v * 7);
+    EXPECT_EQ(color_to_rgb565(color, false), reference_color_to_rgb565(color, false));
+    EXPECT_EQ(color_to_rgb565(color, true), reference_color_to_rgb565(color, true));
+  }
+}
+
+TEST(PixelOpsTest, Fill) {
+  for (size_t count : {0u, 1u, 2u, 5u, 64u, 100u}) {
+    std::vector<uint8_t> row24(count * 3 + 1, 0xAA);
+    fill_24(row24.data(), 1, 2, 3, count);
+    for (size_t i = 0; i != count; i++) {
+      EXPECT_EQ(row24[i * 3], 1);
+      EXPECT_EQ(row24[i * 3 + 1], 2);
+      EXPECT_EQ(row24[i * 3 + 2], 3);
+    }
+    EXPECT_EQ(row24[count * 3], 0xAA) << "count " << count;
+  }
+}
+
+TEST(PixelOpsTest, Rgb565ToRgb666Golden) {
+  const uint16_t src[] = {0xF800, 0x07E0, 0x001F, 0xFFFF};
+  const uint8_t expected[] = {0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xFC, 0xF8};
+  uint8_t dst[sizeof(expected)];
+  rgb565_to_rgb666(dst, src, 4, false);
+  EXPECT_EQ(0, memcmp(dst, expected, sizeof(expected)));
+}
+
+TEST(PixelOpsTest, Rgb565ToRgb666Exhaustive) {
+  std::vector<uint16_t> src(65536);
+  for (size_t i = 0; i != src.size(); i++)
+    src[i] = i;
+  std::vector<uint8_t> dst(src.size() * 3);
+  for (bool big_endian : {false, true}) {
+    rgb565_to_rgb666(dst.data(), src.data(), src.size(), big_endian);
+    for (size_t i = 0; i != src.size(); i++) {
+      uint8_t expected[3];
+      reference_rgb565_to_rgb666(expected, src[i], big_endian);
+      ASSERT_EQ(0, memcmp(&dst[i * 3], expected, 3)) << "pixel " << i << " big_endian " << big_endian;
+    }
+  }
+}
+
+TEST(PixelOpsTest, Rgb332Exhaustive) {
+  uint8_t src[256];
+  for (int i = 0; i != 256; i++)
+    src[i] = i;
+  uint8_t bgr[256 * 3];
+  rgb332_to_bgr666(bgr, src, 256);
+  uint8_t le[256 * 2];
+  uint8_t be[256 * 2];
+  rgb332_to_rgb565(le, src, 256, false);
+  rgb332_to_rgb565(be, src, 256, true);
+  for (int i = 0; i != 256; i++) {
+    uint8_t v = src[i];
+    EXPECT_EQ(bgr[i * 3], static_cast<uint8_t>(v << 6));
+    EXPECT_EQ(bgr[i * 3 + 1], (v & 0x1C) << 3);
+    EXPECT_EQ(bgr[i * 3 + 2], v & 0xE0);
+    EXPECT_EQ(le[i * 2], (v & 3) << 3);
+    EXPECT_EQ(le[i * 2 + 1], (v & 0xE0) | ((v & 0x1C) >> 2));
+    EXPECT_EQ(be[i * 2], le[i * 2 + 1]);
+    EXPECT_EQ(be[i * 2 + 1], le[i * 2]);
+  }
+}
+
+TEST(PixelOpsTest, BlendMatchesBlendColor) {
+  const Color color(250, 20, 128);
+  const Color background(3, 240, 64);
+  uint8_t alpha[256];
+  for (int i = 0; i != 256; i++)
+    alpha[i] = i;
+  for (bool big_endian : {false, true}) {
+    std::vector<uint16_t> dst(256, 0x1234);
+    blend_rgb565(dst.data(), alpha, color, background, 256, big_endian);
+    // Zero coverage leaves the pixel untouched
+    EXPECT_EQ(dst[0], 0x1234);
+    for (int i = 1; i != 256; i++) {
+      EXPECT_EQ(dst[i], reference_color_to_rgb565(blend_color(color, background, i), big_endian))
+          << "alpha " << i << " big_endian " << big_endian;
+    }
+  }
+}
+
+}  // namespace esphome::display::testing
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "esphome/components/e131/e131_addressable_light_effect.h"
+#include "esphome/components/light/light_state.h"
+
+namespace esphome::e131::testing {
+
+// A strip that keeps its RGB pixels in one buffer, or in two if split_at is set, so the effect writes through views.
+// The buffer continues past the last pixel, so writes beyond the end of the light are caught.
+class FakeLight : public light::AddressableLight {
+ public:
+  FakeLight(int32_t size, const char *order) : size_(size), buffer_(size * 3 + 1 + 16), effect_data_(size) {
+    for (int i = 0; i < 3; i++)
+      this->offsets_[order[i] == 'R' ? 0 : order[i] == 'G' ? 1 : 2] = i;
+    this->correction_.calculate_gamma_table(1.0f);
+  }
+
+  int32_t size() const override { return this->size_; }
+  void clear_effect_data() override {}
+  light::LightTraits get_traits() override { return {}; }
+  void write_state(light::LightState *state) override {}
+
+  /// Red, green and blue of each pixel, in that order
+  std::vector<uint8_t> pixels() {
+    std::vector<uint8_t> result;
+    for (int32_t i = 0; i < this->size_; i++) {
+      auto view = (*this)[i];
+      result.insert(result.end(), {view.get_red_raw(), view.get_green_raw(), view.get_blue_raw()});
+    }
+    return result;
+  }
+
+  bool written_past_end() const {
+    const size_t end = this->size_ * 3 + (this->split_at >= 0 ? 1 : 0);
+    return std::any_of(this->buffer_.begin() + end, this->buffer_.end(), [](uint8_t b) { return b != 0; });
+  }
+
+  int32_t split_at{-1};
+
+ protected:
+  light::ESPColorView get_view_internal(int32_t index) const override {
+    uint8_t *base = const_cast<uint8_t *>(this->buffer_.data()) + index * 3;
+    if (this->split_at >= 0 && index >= this->split_at)
+      base++;
+    return light::ESPColorView(base + this->offsets_[0], base + this->offsets_[1], base + this->offsets_[2], nullptr,
+                               const_cast<uint8_t *>(&this->effect_data_[index]), &this->correction_);
+  }
+
+  int32_t size_;
+  uint8_t offsets_[3];
+  std::vector<uint8_t> buffer_;
+  std::vector<uint8_t> effect_data_;
+};
+
+class TestEffect : public E131AddressableLightEffect {
+ public:
+  TestEffect(light::LightState *state) : E131AddressableLightEffect("test") {
+    this->init_internal(state);
+    this->set_first_universe(1);
+  }
+
+  using E131AddressableLightEffect::receive_universe_;
+  using E131AddressableLightEffect::write_channels_;
+
+  bool take_show() { return this->show_pending_.exchange(false); }
+};
+
+// Runs a test once for each way the effect writes pixels: copied, through the lookup, and through views
+class E131WriteChannelsTest : public ::testing::TestWithParam<int> {
+ protected:
+  void start(int32_t size) {
+    const int mode = GetParam();
+    this->light_ = std::make_unique<FakeLight>(size, mode == 1 ? "GRB" : "RGB");
+    if (mode == 2)
+      this->light_->split_at = size / 2;
+    this->state_ = std::make_unique<light::LightState>(this->light_.get());
+    this->effect_ = std::make_unique<TestEffect>(this->state_.get());
+    this->effect_->start();
+  }
+
+  std::vector<uint8_t> expected(int32_t size, int32_t pixel, const std::vector<uint8_t> &values) {
+    std::vector<uint8_t> result(size * 3);
+    std::copy(values.begin(), values.end(), result.begin() + pixel * 3);
+    return result;
+  }
+
+  std::unique_ptr<FakeLight> light_;
+  std::unique_ptr<light::LightState> state_;
+  std::unique_ptr<TestEffect> effect_;
+};
+
+TEST_P(E131WriteChannelsTest, WritesAtOffset) {
+  this->start(6);
+  const uint8_t data[] = {1, 2, 3, 4, 5, 6};
+  this->effect_->write_channels_(6, data, sizeof(data));
+  EXPECT_EQ(this->light_->pixels(), this->expected(6, 2, {1, 2, 3, 4, 5, 6}));
+}
+
+TEST_P(E131WriteChannelsTest, DropsSplitPixels) {
+  this->start(6);
+  // Starts in the middle of pixel 1 and ends in the middle of pixel 4
+  const uint8_t data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  this->effect_->write_channels_(4, data, sizeof(data));
+  EXPECT_EQ(this->light_->pixels(), this->expected(6, 2, {3, 4, 5, 6, 7, 8}));
+}
+
+TEST_P(E131WriteChannelsTest, TruncatesAtEndOfLight) {
+  this->start(4);
+  const uint8_t data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  this->effect_->write_channels_(6, data, sizeof(data));
+  EXPECT_EQ(this->light_->pixels(), this->expected(4, 2, {1, 2, 3, 4, 5, 6}));
+  EXPECT_FALSE(this->light_->written_past_end());
+}
+
+TEST_P(E131WriteChannelsTest, IgnoresDataOutsideLight) {
+  this->start(4);
+  const uint8_t data[] = {1, 2, 3, 4, 5, 6};
+  this->effect_->write_channels_(12, data, sizeof(data));
+  this->effect_->write_channels_(1000000, data, sizeof(data));
+  // Nothing left once the rest of the split pixel is skipped
+  this->effect_->write_channels_(1, data, 2);
+  EXPECT_EQ(this->light_->pixels(), this->expected(4, 0, {}));
+  EXPECT_FALSE(this->light_->written_past_end());
+}
+
+TEST_P(E131WriteChannelsTest, UsesCorrectionFromMainLoop) {
+  this->start(4);
+  const uint8_t data[] = {200, 100, 50};
+  this->light_->set_correction(0.5f, 0.5f, 0.5f);
+  // The receive task keeps the correction taken when the effect started
+  this->effect_->write_channels_(0, data, sizeof(data));
+  EXPECT_EQ(this->light_->pixels(), this->expected(4, 0, {200, 100, 50}));
+
+  // Until the main loop runs the effect and hands the new one over
+  this->effect_->apply(*this->light_, Color());
+  this->effect_->write_channels_(0, data, sizeof(data));
+  const auto &correction = this->light_->get_correction();
+  EXPECT_EQ(this->light_->pixels(),
+            this->expected(4, 0,
+                           {correction.color_correct_red(200), correction.color_correct_green(100),
+                            correction.color_correct_blue(50)}));
+  EXPECT_NE(this->light_->pixels()[0], 200);
+}
+
+INSTANTIATE_TEST_SUITE_P(Paths, E131WriteChannelsTest, ::testing::Values(0, 1, 2), [](const auto &info) {
+  return info.param == 0 ? "Copy" : info.param == 1 ? "Lookup" : "Views";
+});
+
+class E131ReceiveUniverseTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // 170 RGB pixels fit in a universe, so this light spans three
+    this->light_ = std::make_unique<FakeLight>(400, "RGB");
+    this->state_ = std::make_unique<light::LightState>(this->light_.get());
+    this->effect_ = std::make_unique<TestEffect>(this->state_.get());
+    this->effect_->start();
+    ASSERT_EQ(this->effect_->get_universe_count(), 3);
+  }
+
+  std::unique_ptr<FakeLight> light_;
+  std::unique_ptr<light::LightState> state_;
+  std::unique_ptr<TestEffect> effect_;
+};
+
+TEST_F(E131ReceiveUniverseTest, ShowsCompleteFrame) {
+  this->effect_->receive_universe_(0);
+  this->effect_->receive_universe_(1);
+  EXPECT_FALSE(this->effect_->take_show());
+  this->effect_->receive_universe_(2);
+  EXPECT_TRUE(this->effect_->take_show());
+
+  // In any order
+  this->effect_->receive_universe_(2);
+  this->effect_->receive_universe_(0);
+  EXPECT_FALSE(this->effect_->take_show());
+  this->effect_->receive_universe_(1);
+  EXPECT_TRUE(this->effect_->take_show());
+}
+
+TEST_F(E131ReceiveUniverseTest, RepeatedUniverseStartsNextFrame) {
+  this->effect_->receive_universe_(0);
+  this->effect_->receive_universe_(1);
+  // Universe 2 of this frame was lost; the sender is on the next frame
+  this->effect_->receive_universe_(0);
+  EXPECT_TRUE(this->effect_->take_show());
+  // The repeated universe counts towards the new frame
+  this->effect_->receive_universe_(1);
+  EXPECT_FALSE(this->effect_->take_show());
+  this->effect_->receive_universe_(2);
+  EXPECT_TRUE(this->effect_->take_show());
+}
+
+}  // namespace esphome::e131::testing
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "esphome/components/e131/e131.h"
+
+namespace esphome::e131::testing {
+
+class TestE131Component : public E131Component {
+ public:
+  using E131Component::ddp_packet_;
+  using E131Component::packet_;
+};
+
+// Offsets into an E1.31 datagram
+static constexpr size_t E131_ROOT_VECTOR = 18;
+static constexpr size_t E131_FRAME_VECTOR = 40;
+static constexpr size_t E131_UNIVERSE = 113;
+static constexpr size_t E131_DMP_VECTOR = 117;
+static constexpr size_t E131_VALUE_COUNT = 123;
+static constexpr size_t E131_VALUES = 125;
+
+// A datagram for the universe carrying the start code followed by the given channel values
+static std::vector<uint8_t> e131_datagram(uint16_t universe, const std::vector<uint8_t> &channels) {
+  static const uint8_t ACN_ID[] = {0x41, 0x53, 0x43, 0x2d, 0x45, 0x31, 0x2e, 0x31, 0x37, 0x00, 0x00, 0x00};
+  std::vector<uint8_t> data(E131_VALUES + 1 + channels.size());
+  std::copy(std::begin(ACN_ID), std::end(ACN_ID), data.begin() + 4);
+  data[E131_ROOT_VECTOR + 3] = 4;
+  data[E131_FRAME_VECTOR + 3] = 2;
+  data[E131_UNIVERSE] = universe >> 8;
+  data[E131_UNIVERSE + 1] = universe;
+  data[E131_DMP_VECTOR] = 2;
+  const uint16_t count = channels.size() + 1;
+  data[E131_VALUE_COUNT] = count >> 8;
+  data[E131_VALUE_COUNT + 1] = count;
+  std::copy(channels.begin(), channels.end(), data.begin() + E131_VALUES + 1);
+  return data;
+}
+
+TEST(E131PacketTest, ParsesUniverseAndValues) {
+  TestE131Component component;
+  auto data = e131_datagram(258, {10, 20, 30});
+  int universe = 0;
+  E131Packet packet;
+  ASSERT_TRUE(component.packet_(data.data(), data.size(), universe, packet));
+  EXPECT_EQ(universe, 258);
+  EXPECT_EQ(packet.count, 4);
+  EXPECT_EQ(packet.values, data.data() + E131_VALUES);
+  EXPECT_EQ(packet.values[0], 0);
+  EXPECT_EQ(packet.values[3], 30);
+}
+
+TEST(E131PacketTest, RejectsShortDatagrams) {
+  TestE131Component component;
+  auto data = e131_datagram(1, {10, 20, 30});
+  int universe;
+  E131Packet packet;
+  // Shorter than the headers and a single value
+  EXPECT_FALSE(component.packet_(data.data(), E131_VALUES + 1, universe, packet));
+  // The value count claims more values than the datagram carries
+  EXPECT_FALSE(component.packet_(data.data(), data.size() - 1, universe, packet));
+  EXPECT_TRUE(component.packet_(data.data(), data.size(), universe, packet));
+  // Trailing bytes beyond the values are fine
+  data.push_back(0xFF);
+  EXPECT_TRUE(component.packet_(data.data(), data.size(), universe, packet));
+  EXPECT_EQ(packet.count, 4);
+}
+
+TEST(E131PacketTest, RejectsTooManyValues) {
+  TestE131Component component;
+  auto data = e131_datagram(1, std::vector<uint8_t>(E131_MAX_PROPERTY_VALUES_COUNT));
+  int universe;
+  E131Packet packet;
+  data[E131_VALUE_COUNT] = 0x02;
+  data[E131_VALUE_COUNT + 1] = 0x01;
+  EXPECT_TRUE(component.packet_(data.data(), data.size(), universe, packet));
+  data[E131_VALUE_COUNT + 1] = 0x02;
+  EXPECT_FALSE(component.packet_(data.data(), data.size(), universe, packet));
+}
+
+TEST(E131PacketTest, RejectsOtherPackets) {
+  TestE131Component component;
+  int universe;
+  E131Packet packet;
+  for (size_t offset : {size_t(4), E131_ROOT_VECTOR + 3, E131_FRAME_VECTOR + 3, E131_DMP_VECTOR, E131_VALUES}) {
+    auto data = e131_datagram(1, {10, 20, 30});
+    data[offset] ^= 0x01;
+    EXPECT_FALSE(component.packet_(data.data(), data.size(), universe, packet)) << "offset " << offset;
+  }
+}
+
+// A DDP datagram with the given flags and data offset, addressed to the display
+static std::vector<uint8_t> ddp_datagram(uint8_t flags, uint32_t offset, const std::vector<uint8_t> &values) {
+  std::vector<uint8_t> data = {flags,
+                               0,
+                               0x01,
+                               0x01,
+                               uint8_t(offset >> 24),
+                               uint8_t(offset >> 16),
+                               uint8_t(offset >> 8),
+                               uint8_t(offset),
+                               uint8_t(values.size() >> 8),
+                               uint8_t(values.size())};
+  if (flags & 0x10)
+    data.insert(data.end(), {0xAA, 0xBB, 0xCC, 0xDD});
+  data.insert(data.end(), values.begin(), values.end());
+  return data;
+}
+
+TEST(DDPPacketTest, ParsesOffsetAndValues) {
+  TestE131Component component;
+  auto data = ddp_datagram(0x41, 0x01020304, {1, 2, 3, 4, 5, 6});
+  DDPPacket packet;
+  ASSERT_TRUE(component.ddp_packet_(data.data(), data.size(), packet));
+  EXPECT_EQ(packet.offset, 0x01020304u);
+  EXPECT_EQ(packet.count, 6);
+  EXPECT_EQ(packet.values, data.data() + 10);
+  EXPECT_TRUE(packet.push);
+
+  data = ddp_datagram(0x40, 3, {1, 2, 3});
+  ASSERT_TRUE(component.ddp_packet_(data.data(), data.size(), packet));
+  EXPECT_FALSE(packet.push);
+}
+
+TEST(DDPPacketTest, SkipsTimecode) {
+  TestE131Component component;
+  auto data = ddp_datagram(0x51, 0, {7, 8, 9});
+  DDPPacket packet;
+  ASSERT_TRUE(component.ddp_packet_(data.data(), data.size(), packet));
+  EXPECT_EQ(packet.values, data.data() + 14);
+  EXPECT_EQ(packet.values[0], 7);
+  EXPECT_EQ(packet.count, 3);
+  // The timecode counts towards the length the datagram needs
+  EXPECT_FALSE(component.ddp_packet_(data.data(), data.size() - 1, packet));
+}
+
+TEST(DDPPacketTest, RejectsShortDatagrams) {
+  TestE131Component component;
+  auto data = ddp_datagram(0x41, 0, {1, 2, 3});
+  DDPPacket packet;
+  EXPECT_FALSE(component.ddp_packet_(data.data(), 9, packet));
+  EXPECT_FALSE(component.ddp_packet_(data.data(), data.size() - 1, packet));
+  // A header without data is a valid, if empty, packet
+  auto empty = ddp_datagram(0x41, 0, {});
+  EXPECT_TRUE(component.ddp_packet_(empty.data(), empty.size(), packet));
+  EXPECT_EQ(packet.count, 0);
+}
+
+TEST(DDPPacketTest, RejectsOtherPackets) {
+  TestE131Component component;
+  DDPPacket packet;
+  // Version 2, storage, reply and query
+  for (uint8_t flags : {0x81, 0x49, 0x45, 0x43}) {
+    auto data = ddp_datagram(flags, 0, {1, 2, 3});
+    EXPECT_FALSE(component.ddp_packet_(data.data(), data.size(), packet)) << "flags " << int(flags);
+  }
+  // Only the display and broadcast IDs carry pixels
+  auto data = ddp_datagram(0x41, 0, {1, 2, 3});
+  data[3] = 2;
+  EXPECT_FALSE(component.ddp_packet_(data.data(), data.size(), packet));
+  data[3] = 255;
+  EXPECT_TRUE(component.ddp_packet_(data.data(), data.size(), packet));
+}
+
+}  // namespace esphome::e131::testing
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "esphome/components/i2c/i2c.h"
+
+namespace esphome::i2c::testing {
+
+// A bus that records every transfer and answers reads with an incrementing byte pattern
+class RecordingBus : public I2CBus {
+ public:
+  struct Transfer {
+    uint8_t address;
+    std::vector<uint8_t> written;
+    size_t read_count;
+  };
+
+  ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                        size_t read_count) override {
+    this->transfers.push_back({address, std::vector<uint8_t>(write_buffer, write_buffer + write_count), read_count});
+    if (this->transfers.size() == this->fail_at)
+      return ERROR_NOT_ACKNOWLEDGED;
+    for (size_t i = 0; i < read_count; i++)
+      read_buffer[i] = this->next_byte++;
+    return ERROR_OK;
+  }
+
+  std::vector<Transfer> transfers;
+  size_t fail_at{0};
+  uint8_t next_byte{0x10};
+};
+
+class TestDevice : public I2CDevice {
+ public:
+  explicit TestDevice(I2CBus *bus) {
+    this->set_i2c_bus(bus);
+    this->set_i2c_address(0x44);
+  }
+};
+
+TEST(I2CTransactionTest, StepsRunInOrder) {
+  RecordingBus bus;
+  TestDevice device(&bus);
+  const uint8_t command[] = {0x24, 0x00};
+  const uint8_t value = 0xA5;
+  uint8_t config[2];
+  uint8_t result[3];
+  I2CTransaction transaction;
+  transaction.write(command, sizeof(command))
+      .write_register(0x01, &value, 1)
+      .read_register(0x02, config, sizeof(config))
+      .read(result, sizeof(result));
+
+  int calls = 0;
+  ErrorCode result_err = ERROR_UNKNOWN;
+  EXPECT_EQ(device.submit(&transaction,
+                          [&](ErrorCode err) {
+                            calls++;
+                            result_err = err;
+                          }),
+            ERROR_OK);
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(result_err, ERROR_OK);
+  EXPECT_FALSE(transaction.is_pending());
+
+  ASSERT_EQ(bus.transfers.size(), 4u);
+  EXPECT_EQ(bus.transfers[0].written, (std::vector<uint8_t>{0x24, 0x00}));
+  EXPECT_EQ(bus.transfers[1].written, (std::vector<uint8_t>{0x01, 0xA5}));
+  EXPECT_EQ(bus.transfers[2].written, (std::vector<uint8_t>{0x02}));
+  EXPECT_EQ(bus.transfers[2].read_count, 2u);
+  EXPECT_TRUE(bus.transfers[3].written.empty());
+  EXPECT_EQ(bus.transfers[3].read_count, 3u);
+  for (const auto &transfer : bus.transfers)
+    EXPECT_EQ(transfer.address, 0x44);
+  EXPECT_EQ(config[0], 0x10);
+  EXPECT_EQ(config[1], 0x11);
+  EXPECT_EQ(result[2], 0x14);
+}
+
+TEST(I2CTransactionTest, StopsAtFirstError) {
+  RecordingBus bus;
+  TestDevice device(&bus);
+  uint8_t data[2];
+  I2CTransaction transaction;
+  const uint8_t value = 1;
+  transaction.write_register(0x10, &value, 1).read_register(0x11, data, 2).read_register(0x12, data, 2);
+  bus.fail_at = 2;
+
+  ErrorCode result_err = ERROR_OK;
+  EXPECT_EQ(device.submit(&transaction, [&](ErrorCode err) { result_err = err; }), ERROR_OK);
+  EXPECT_EQ(result_err, ERROR_NOT_ACKNOWLEDGED);
+  EXPECT_EQ(bus.transfers.size(), 2u);
+}
+
+TEST(I2CTransactionTest, ReusedAfterClear) {
+  RecordingBus bus;
+  TestDevice device(&bus);
+  I2CTransaction transaction;
+  uint8_t data[4];
+  for (uint8_t reg = 0; reg < 3; reg++) {
+    transaction.clear();
+    transaction.read_register(reg, data, sizeof(data));
+    EXPECT_EQ(device.submit(&transaction, [](ErrorCode) {}), ERROR_OK);
+  }
+  ASSERT_EQ(bus.transfers.size(), 3u);
+  EXPECT_EQ(bus.transfers[2].written, (std::vector<uint8_t>{0x02}));
+}
+
+TEST(I2CTransactionTest, RejectsOversizedInlineWrite) {
+  RecordingBus bus;
+  TestDevice device(&bus);
+  const uint8_t data[I2CTransaction::INLINE_WRITE_SIZE] = {};
+  I2CTransaction transaction;
+  transaction.write_register(0x01, data, sizeof(data));
+
+  bool called = false;
+  EXPECT_EQ(device.submit(&transaction, [&](ErrorCode) { called = true; }), ERROR_TOO_LARGE);
+  EXPECT_FALSE(called);
+  EXPECT_TRUE(bus.transfers.empty());
+
+  transaction.clear();
+  transaction.write_register(0x01, data, sizeof(data) - 1);
+  EXPECT_EQ(device.submit(&transaction, [&](ErrorCode) { called = true; }), ERROR_OK);
+  EXPECT_TRUE(called);
+}
+
+}  // namespace esphome::i2c::testing
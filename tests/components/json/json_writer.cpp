@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "esphome/components/json/json_writer.h"
+
+namespace esphome::json::testing {
+
+TEST(JsonWriterTest, FlatObject) {
+  StaticJsonWriter<128> writer;
+  writer.begin_object();
+  writer.add("id", "sensor-temperature");
+  writer.add("value", 23.5f);
+  writer.add("state", "23.5 °C");
+  writer.add("on", true);
+  writer.end_object();
+  EXPECT_FALSE(writer.overflowed());
+  EXPECT_STREQ(writer.c_str(), R"({"id":"sensor-temperature","value":23.5,"state":"23.5 °C","on":true})");
+  EXPECT_EQ(writer.size(), strlen(writer.c_str()));
+}
+
+TEST(JsonWriterTest, NestedContainers) {
+  StaticJsonWriter<128> writer;
+  writer.begin_object();
+  writer.begin_object("color");
+  writer.add("r", static_cast<int32_t>(-1));
+  writer.add("g", static_cast<uint32_t>(255));
+  writer.end_object();
+  writer.begin_array("effects");
+  writer.add(nullptr, "None");
+  writer.add(nullptr, "Rainbow");
+  writer.end_array();
+  writer.add_null("empty");
+  writer.end_object();
+  EXPECT_STREQ(writer.c_str(), R"({"color":{"r":-1,"g":255},"effects":["None","Rainbow"],"empty":null})");
+}
+
+TEST(JsonWriterTest, EscapesStrings) {
+  StaticJsonWriter<64> writer;
+  writer.begin_object();
+  writer.add("s", "a\"b\\c\nd\x01");
+  writer.end_object();
+  EXPECT_STREQ(writer.c_str(), R"({"s":"a\"b\\c\nd\u0001"})");
+}
+
+TEST(JsonWriterTest, PiecewiseString) {
+  StaticJsonWriter<64> writer;
+  writer.begin_object();
+  writer.begin_string("id");
+  writer.append_string("switch");
+  writer.append_string("-", 1);
+  writer.append_string("relay_1");
+  writer.end_string();
+  writer.end_object();
+  EXPECT_STREQ(writer.c_str(), R"({"id":"switch-relay_1"})");
+}
+
+TEST(JsonWriterTest, NonFiniteFloatIsNull) {
+  StaticJsonWriter<32> writer;
+  writer.begin_object();
+  writer.add("value", NAN);
+  writer.end_object();
+  EXPECT_STREQ(writer.c_str(), R"({"value":null})");
+}
+
+TEST(JsonWriterTest, OverflowIsReportedAndTerminated) {
+  StaticJsonWriter<16> writer;
+  writer.begin_object();
+  writer.add("key", "a value that does not fit");
+  writer.end_object();
+  EXPECT_TRUE(writer.overflowed());
+  EXPECT_LT(strlen(writer.c_str()), 16u);
+}
+
+}  // namespace esphome::json::testing
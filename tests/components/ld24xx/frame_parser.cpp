@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "esphome/components/ld24xx/frame_parser.h"
+
+namespace esphome::ld24xx::testing {
+
+static constexpr uint8_t CMD_HEADER[] = {0xFD, 0xFC, 0xFB, 0xFA};
+static constexpr uint8_t CMD_FOOTER[] = {0x04, 0x03, 0x02, 0x01};
+static constexpr uint8_t LD2410_DATA_HEADER[] = {0xF4, 0xF3, 0xF2, 0xF1};
+static constexpr uint8_t LD2410_DATA_FOOTER[] = {0xF8, 0xF7, 0xF6, 0xF5};
+static constexpr uint8_t LD2450_DATA_HEADER[] = {0xAA, 0xFF, 0x03, 0x00};
+static constexpr uint8_t LD2450_DATA_FOOTER[] = {0x55, 0xCC};
+
+static constexpr FrameFormat LD2410_FORMATS[] = {
+    {FRAME_TYPE_DATA, LD2410_DATA_HEADER, LD2410_DATA_FOOTER, 0},
+    {FRAME_TYPE_ACK, CMD_HEADER, CMD_FOOTER, 0},
+};
+static constexpr FrameFormat LD2450_FORMATS[] = {
+    {FRAME_TYPE_DATA, LD2450_DATA_HEADER, LD2450_DATA_FOOTER, 30},
+    {FRAME_TYPE_ACK, CMD_HEADER, CMD_FOOTER, 0},
+};
+
+// Captured from an LD2410B in normal mode: moving target at 81 cm
+static const std::vector<uint8_t> LD2410_DATA = {0xF4, 0xF3, 0xF2, 0xF1, 0x0D, 0x00, 0x02, 0xAA,
+                                                 0x02, 0x51, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x00,
+                                                 0x00, 0x55, 0x00, 0xF8, 0xF7, 0xF6, 0xF5};
+// Captured from an LD2410B: acknowledgement of the enable configuration command
+static const std::vector<uint8_t> LD2410_ACK = {0xFD, 0xFC, 0xFB, 0xFA, 0x08, 0x00, 0xFF, 0x01, 0x00,
+                                                0x00, 0x01, 0x00, 0x40, 0x00, 0x04, 0x03, 0x02, 0x01};
+// Captured from an LD2450: one target, two empty slots
+static const std::vector<uint8_t> LD2450_DATA = {0xAA, 0xFF, 0x03, 0x00, 0x0E, 0x03, 0xB1, 0x86, 0x10, 0x00,
+                                                 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                                 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xCC};
+
+struct Frame {
+  FrameType type;
+  std::vector<uint8_t> data;
+  bool operator==(const Frame &other) const { return this->type == other.type && this->data == other.data; }
+};
+
+template<size_t N> class Collector {
+ public:
+  explicit Collector(std::span<const FrameFormat> formats) { this->parser.set_formats(formats); }
+
+  void feed(const std::vector<uint8_t> &stream, size_t chunk) {
+    for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+      const size_t len = std::min(chunk, stream.size() - pos);
+      this->parser.feed(stream.data() + pos, len, [this](const FrameFormat &format, std::span<const uint8_t> frame) {
+        this->frames.push_back({format.type, std::vector<uint8_t>(frame.begin(), frame.end())});
+      });
+    }
+  }
+
+  StaticFrameParser<N> parser;
+  std::vector<Frame> frames;
+};
+
+static std::vector<uint8_t> concat(std::initializer_list<std::vector<uint8_t>> parts) {
+  std::vector<uint8_t> out;
+  for (const auto &part : parts)
+    out.insert(out.end(), part.begin(), part.end());
+  return out;
+}
+
+TEST(LD24xxFrameParserTest, SplitsStreamInAnyChunking) {
+  const auto stream = concat({LD2410_DATA, LD2410_ACK, LD2410_DATA});
+  const std::vector<Frame> expected = {
+      {FRAME_TYPE_DATA, LD2410_DATA}, {FRAME_TYPE_ACK, LD2410_ACK}, {FRAME_TYPE_DATA, LD2410_DATA}};
+  for (size_t chunk : {1u, 3u, 7u, 16u, 64u, 1000u}) {
+    Collector<46> collector(LD2410_FORMATS);
+    collector.feed(stream, chunk);
+    EXPECT_EQ(collector.frames, expected) << "chunk " << chunk;
+    EXPECT_EQ(collector.parser.get_discarded_bytes(), 0u);
+  }
+}
+
+TEST(LD24xxFrameParserTest, SkipsNoiseBetweenFrames) {
+  const std::vector<uint8_t> noise = {0x00, 0x13, 0xF8, 0xF7, 0xF6, 0xF5, 0x04, 0x03, 0x02, 0x01, 0x37};
+  const auto stream = concat({noise, LD2410_DATA, noise, noise, LD2410_ACK});
+  for (size_t chunk : {1u, 5u, 64u}) {
+    Collector<46> collector(LD2410_FORMATS);
+    collector.feed(stream, chunk);
+    ASSERT_EQ(collector.frames.size(), 2u);
+    EXPECT_EQ(collector.frames[0].data, LD2410_DATA);
+    EXPECT_EQ(collector.frames[1].data, LD2410_ACK);
+    EXPECT_EQ(collector.parser.get_discarded_bytes(), 3 * noise.size());
+  }
+}
+
+TEST(LD24xxFrameParserTest, ResyncsInsideTruncatedFrame) {
+  // A frame cut short by a glitch: the next frame starts within the bytes already buffered for it
+  std::vector<uint8_t> truncated(LD2410_DATA.begin(), LD2410_DATA.begin() + 12);
+  for (size_t chunk : {1u, 8u, 64u}) {
+    Collector<46> collector(LD2410_FORMATS);
+    collector.feed(concat({truncated, LD2410_DATA, LD2410_ACK}), chunk);
+    ASSERT_EQ(collector.frames.size(), 2u) << "chunk " << chunk;
+    EXPECT_EQ(collector.frames[0].data, LD2410_DATA);
+    EXPECT_EQ(collector.frames[1].data, LD2410_ACK);
+  }
+}
+
+TEST(LD24xxFrameParserTest, RejectsOversizedLength) {
+  // A header followed by a length the buffer cannot hold is dropped at once instead of swallowing later frames
+  const std::vector<uint8_t> bogus = {0xF4, 0xF3, 0xF2, 0xF1, 0xFF, 0x00};
+  Collector<46> collector(LD2410_FORMATS);
+  collector.feed(concat({bogus, LD2410_DATA}), 4);
+  ASSERT_EQ(collector.frames.size(), 1u);
+  EXPECT_EQ(collector.frames[0].data, LD2410_DATA);
+  EXPECT_EQ(collector.parser.get_discarded_bytes(), bogus.size());
+}
+
+TEST(LD24xxFrameParserTest, RejectsBadFooter) {
+  auto corrupt = LD2410_DATA;
+  corrupt[corrupt.size() - 1] = 0x00;
+  Collector<46> collector(LD2410_FORMATS);
+  collector.feed(concat({corrupt, LD2410_DATA}), 64);
+  ASSERT_EQ(collector.frames.size(), 1u);
+  EXPECT_EQ(collector.frames[0].data, LD2410_DATA);
+}
+
+TEST(LD24xxFrameParserTest, FixedSizeFrames) {
+  // LD2450 data frames have no length field, and their payload may contain the footer bytes
+  auto frame = LD2450_DATA;
+  frame[20] = 0x55;
+  frame[21] = 0xCC;
+  const auto stream = concat({{0x55, 0xCC, 0xAA}, frame, LD2450_DATA, LD2410_ACK, LD2450_DATA});
+  for (size_t chunk : {1u, 9u, 64u}) {
+    Collector<41> collector(LD2450_FORMATS);
+    collector.feed(stream, chunk);
+    const std::vector<Frame> expected = {{FRAME_TYPE_DATA, frame},
+                                         {FRAME_TYPE_DATA, LD2450_DATA},
+                                         {FRAME_TYPE_ACK, LD2410_ACK},
+                                         {FRAME_TYPE_DATA, LD2450_DATA}};
+    EXPECT_EQ(collector.frames, expected) << "chunk " << chunk;
+  }
+}
+
+}  // namespace esphome::ld24xx::testing
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "esphome/components/light/addressable_light.h"
+
+namespace esphome::light::testing {
+
+// A strip that keeps its pixels wherever a test puts them
+class FakeLight : public AddressableLight {
+ public:
+  FakeLight(int32_t size, const char *order, bool white)
+      : size_(size), stride_(white ? 4 : 3), buffer_(size * (white ? 4 : 3)), effect_data_(size) {
+    for (int i = 0; i < 3; i++)
+      this->offsets_[order[i] == 'R' ? 0 : order[i] == 'G' ? 1 : 2] = i;
+    this->white_ = white ? 3 : -1;
+  }
+
+  int32_t size() const override { return this->size_; }
+  void clear_effect_data() override {}
+  LightTraits get_traits() override { return {}; }
+  void write_state(LightState *state) override {}
+
+  uint8_t *data() { return this->buffer_.data(); }
+  int32_t split_at{-1};  ///< pixels from here on are shifted by one byte, as if they were in a second buffer
+
+ protected:
+  ESPColorView get_view_internal(int32_t index) const override {
+    uint8_t *base = const_cast<uint8_t *>(this->buffer_.data()) + index * this->stride_;
+    if (this->split_at >= 0 && index >= this->split_at)
+      base++;
+    return ESPColorView(base + this->offsets_[0], base + this->offsets_[1], base + this->offsets_[2],
+                        this->white_ < 0 ? nullptr : base + this->white_,
+                        const_cast<uint8_t *>(&this->effect_data_[index]), &this->correction_);
+  }
+
+  int32_t size_;
+  int32_t stride_;
+  uint8_t offsets_[3];
+  int8_t white_;
+  std::vector<uint8_t> buffer_;
+  std::vector<uint8_t> effect_data_;
+};
+
+TEST(AddressableLightPixelLayoutTest, DescribesInterleavedBuffer) {
+  FakeLight light(10, "GRB", false);
+  ESPPixelLayout layout;
+  ASSERT_TRUE(light.get_pixel_layout(layout));
+  EXPECT_EQ(layout.data, light.data());
+  EXPECT_EQ(layout.stride, 3u);
+  EXPECT_EQ(layout.red, 1);
+  EXPECT_EQ(layout.green, 0);
+  EXPECT_EQ(layout.blue, 2);
+  EXPECT_EQ(layout.white, -1);
+
+  // Writing through the layout lands where the views read from
+  layout.data[4 * layout.stride + layout.red] = 0x12;
+  layout.data[4 * layout.stride + layout.blue] = 0x34;
+  EXPECT_EQ(light[4].get_red_raw(), 0x12);
+  EXPECT_EQ(light[4].get_blue_raw(), 0x34);
+}
+
+TEST(AddressableLightPixelLayoutTest, DescribesWhiteChannel) {
+  FakeLight light(1, "RGB", true);
+  ESPPixelLayout layout;
+  ASSERT_TRUE(light.get_pixel_layout(layout));
+  EXPECT_EQ(layout.stride, 4u);
+  EXPECT_EQ(layout.red, 0);
+  EXPECT_EQ(layout.white, 3);
+}
+
+TEST(AddressableLightPixelLayoutTest, RejectsSplitBuffer) {
+  FakeLight light(10, "RGB", false);
+  light.split_at = 7;
+  ESPPixelLayout layout;
+  EXPECT_FALSE(light.get_pixel_layout(layout));
+}
+
+}  // namespace esphome::light::testing
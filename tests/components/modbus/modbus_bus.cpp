@@ -0,0 +1,230 @@
+#include <deque>
+#include <map>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "esphome/components/modbus/modbus.h"
+#include "esphome/components/uart/uart_component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome::modbus::testing {
+
+static const uint8_t READ_HOLDING_REGISTERS = static_cast<uint8_t>(ModbusFunctionCode::READ_HOLDING_REGISTERS);
+
+// A UART with simulated servers behind it. Every request frame is answered as soon as the master flushes it, so the
+// reply is waiting in the receive buffer on the next loop.
+class SimulatedBus : public uart::UARTComponent {
+ public:
+  using uart::UARTComponent::write_array;
+
+  std::vector<std::vector<uint8_t>> requests;
+  std::deque<uint8_t> rx;
+  /// Register values of the simulated servers by address; addresses not in here stay silent.
+  std::map<uint8_t, uint16_t> servers;
+  bool corrupt_next_reply{false};
+
+  void write_array(const uint8_t *data, size_t len) override {
+    this->pending_.insert(this->pending_.end(), data, data + len);
+  }
+  bool peek_byte(uint8_t *data) override {
+    if (this->rx.empty())
+      return false;
+    *data = this->rx.front();
+    return true;
+  }
+  bool read_array(uint8_t *data, size_t len) override {
+    if (len > this->rx.size())
+      return false;
+    for (size_t i = 0; i < len; i++) {
+      data[i] = this->rx.front();
+      this->rx.pop_front();
+    }
+    return true;
+  }
+  int available() override { return this->rx.size(); }
+  void flush() override {
+    if (this->pending_.empty())
+      return;
+    this->requests.push_back(this->pending_);
+    this->pending_.clear();
+    const auto &request = this->requests.back();
+    auto it = this->servers.find(request[0]);
+    if (it == this->servers.end() || request[1] != READ_HOLDING_REGISTERS)
+      return;
+    // Every register of a read holding registers request reads as the server's value
+    uint16_t count = uint16_t(request[4]) << 8 | request[5];
+    std::vector<uint8_t> reply = {request[0], request[1], static_cast<uint8_t>(count * 2)};
+    for (uint16_t i = 0; i < count; i++) {
+      reply.push_back(it->second >> 8);
+      reply.push_back(it->second);
+    }
+    uint16_t crc = crc16(reply.data(), reply.size());
+    reply.push_back(crc);
+    reply.push_back(crc >> 8);
+    if (this->corrupt_next_reply) {
+      reply[3] ^= 0xFF;
+      this->corrupt_next_reply = false;
+    }
+    this->rx.insert(this->rx.end(), reply.begin(), reply.end());
+  }
+
+ protected:
+  void check_logger_conflict() override {}
+  std::vector<uint8_t> pending_;
+};
+
+// A device that reads one holding register per queued request and records the replies it receives.
+class RecordingDevice : public ModbusDevice {
+ public:
+  RecordingDevice(Modbus *bus, uint8_t address) {
+    this->set_parent(bus);
+    this->set_address(address);
+    bus->register_device(this);
+  }
+
+  uint8_t pending_requests{0};
+  std::vector<std::vector<uint8_t>> frames;
+
+  void on_modbus_data(const std::vector<uint8_t> &data) override { this->frames.push_back(data); }
+  void on_modbus_frame(std::span<const uint8_t> data) override {
+    this->frames.emplace_back(data.begin(), data.end());
+  }
+  bool on_bus_idle() override {
+    if (this->pending_requests == 0)
+      return false;
+    this->pending_requests--;
+    this->send(READ_HOLDING_REGISTERS, 0x0010, 1);
+    return true;
+  }
+};
+
+class TestModbus : public Modbus {
+ public:
+  using Modbus::frame_delay_us_;
+  using Modbus::frame_timeout_ms_;
+};
+
+class ModbusBusTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    this->uart_.set_baud_rate(115200);
+    this->uart_.set_data_bits(8);
+    this->uart_.set_stop_bits(1);
+    this->uart_.set_parity(uart::UART_CONFIG_PARITY_NONE);
+    this->bus_.set_uart_parent(&this->uart_);
+    this->bus_.set_role(ModbusRole::CLIENT);
+    this->bus_.set_disable_crc(false);
+  }
+
+  void run_loops(int count) {
+    for (int i = 0; i < count; i++)
+      this->bus_.loop();
+  }
+
+  SimulatedBus uart_;
+  TestModbus bus_;
+};
+
+TEST_F(ModbusBusTest, FrameTimingFollowsLineSettings) {
+  this->bus_.setup();
+  // Above 19200 baud the inter-frame delay is fixed
+  EXPECT_EQ(this->bus_.frame_delay_us_, 1750u);
+
+  this->uart_.set_baud_rate(9600);
+  this->bus_.setup();
+  // 10 bit characters at 9600 baud take 1041 us, 3.5 of them 3643 us
+  EXPECT_EQ(this->bus_.frame_delay_us_, 3643u);
+
+  // A parity bit makes the characters longer
+  this->uart_.set_parity(uart::UART_CONFIG_PARITY_EVEN);
+  this->bus_.setup();
+  EXPECT_EQ(this->bus_.frame_delay_us_, 4007u);
+  EXPECT_EQ(this->bus_.frame_timeout_ms_, 10u);
+
+  // At low rates the frame timeout grows beyond its floor: 3.5 characters plus one held in the FIFO
+  this->uart_.set_baud_rate(1200);
+  this->uart_.set_parity(uart::UART_CONFIG_PARITY_NONE);
+  this->bus_.setup();
+  EXPECT_EQ(this->bus_.frame_delay_us_, 29165u);
+  EXPECT_EQ(this->bus_.frame_timeout_ms_, 38u);
+}
+
+TEST_F(ModbusBusTest, RepliesAreRoutedInPlace) {
+  RecordingDevice first(&this->bus_, 1);
+  RecordingDevice second(&this->bus_, 2);
+  this->uart_.servers = {{1, 0x1234}, {2, 0xABCD}};
+  this->bus_.setup();
+
+  first.pending_requests = 1;
+  second.pending_requests = 1;
+  this->run_loops(3);
+
+  ASSERT_EQ(first.frames.size(), 1u);
+  EXPECT_EQ(first.frames[0], (std::vector<uint8_t>{0x12, 0x34}));
+  ASSERT_EQ(second.frames.size(), 1u);
+  EXPECT_EQ(second.frames[0], (std::vector<uint8_t>{0xAB, 0xCD}));
+  EXPECT_EQ(this->bus_.waiting_for_response, 0);
+}
+
+TEST_F(ModbusBusTest, DevicesTakeTurns) {
+  RecordingDevice first(&this->bus_, 1);
+  RecordingDevice second(&this->bus_, 2);
+  RecordingDevice third(&this->bus_, 3);
+  this->uart_.servers = {{1, 1}, {2, 2}, {3, 3}};
+  this->bus_.setup();
+
+  first.pending_requests = 3;
+  second.pending_requests = 1;
+  third.pending_requests = 2;
+  this->run_loops(10);
+
+  // A reply is read and the next request sent within the same loop, so no loop is spent idle
+  std::vector<uint8_t> order;
+  for (const auto &request : this->uart_.requests)
+    order.push_back(request[0]);
+  EXPECT_EQ(order, (std::vector<uint8_t>{1, 2, 3, 1, 3, 1}));
+  EXPECT_EQ(first.frames.size(), 3u);
+  EXPECT_EQ(second.frames.size(), 1u);
+  EXPECT_EQ(third.frames.size(), 2u);
+}
+
+TEST_F(ModbusBusTest, NoRequestWhileWaitingForResponse) {
+  RecordingDevice silent(&this->bus_, 7);
+  RecordingDevice other(&this->bus_, 8);
+  this->uart_.servers = {{8, 0}};
+  this->bus_.setup();
+
+  silent.pending_requests = 1;
+  other.pending_requests = 1;
+  this->run_loops(3);
+
+  // The unanswered request holds the bus until send_wait_time has passed
+  ASSERT_EQ(this->uart_.requests.size(), 1u);
+  EXPECT_EQ(this->uart_.requests[0][0], 7);
+  EXPECT_EQ(this->bus_.waiting_for_response, 7);
+  EXPECT_TRUE(other.frames.empty());
+}
+
+TEST_F(ModbusBusTest, CorruptReplyIsDropped) {
+  RecordingDevice device(&this->bus_, 1);
+  this->uart_.servers = {{1, 0x0102}};
+  this->uart_.corrupt_next_reply = true;
+  this->bus_.setup();
+
+  device.pending_requests = 1;
+  this->run_loops(2);
+  EXPECT_TRUE(device.frames.empty());
+  EXPECT_TRUE(this->uart_.rx.empty());
+
+  // A valid frame arriving later is still parsed from a clean buffer
+  std::vector<uint8_t> reply = {1, READ_HOLDING_REGISTERS, 2, 0x01, 0x02};
+  uint16_t crc = crc16(reply.data(), reply.size());
+  reply.push_back(crc);
+  reply.push_back(crc >> 8);
+  this->uart_.rx.insert(this->uart_.rx.end(), reply.begin(), reply.end());
+  this->run_loops(1);
+  ASSERT_EQ(device.frames.size(), 1u);
+  EXPECT_EQ(device.frames[0], (std::vector<uint8_t>{0x01, 0x02}));
+}
+
+}  // namespace esphome::modbus::testing
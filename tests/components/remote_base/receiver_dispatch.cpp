@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "esphome/components/remote_base/remote_base.h"
+#include "esphome/components/remote_base/lg_protocol.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/pioneer_protocol.h"
+#include "esphome/components/remote_base/rc5_protocol.h"
+#include "esphome/components/remote_base/samsung_protocol.h"
+#include "esphome/components/remote_base/sony_protocol.h"
+
+namespace esphome::remote_base::testing {
+
+// Receiver that replays recorded frames instead of capturing them from a pin
+class ReplayReceiver : public RemoteReceiverBase {
+ public:
+  ReplayReceiver() : RemoteReceiverBase(nullptr) {}
+  void replay(const RawTimings &timings) {
+    this->temp_ = timings;
+    this->call_listeners_dumpers_();
+  }
+};
+
+// Listener that counts how often it is asked to decode a frame and how often that succeeds
+template<typename T> class CountingListener : public RemoteReceiverListener {
+ public:
+  uint32_t get_leading_mark() const override { return protocol_leading_mark<T>(); }
+  bool on_receive(RemoteReceiveData src) override {
+    this->calls++;
+    if (!T().decode(src).has_value())
+      return false;
+    this->decoded++;
+    return true;
+  }
+  int calls{0};
+  int decoded{0};
+};
+
+class CountingDumper : public RemoteReceiverDumperBase {
+ public:
+  CountingDumper(uint32_t leading_mark, bool secondary, bool result)
+      : leading_mark_(leading_mark), secondary_(secondary), result_(result) {}
+  uint32_t get_leading_mark() const override { return this->leading_mark_; }
+  bool is_secondary() override { return this->secondary_; }
+  bool dump(RemoteReceiveData src) override {
+    this->calls++;
+    return this->result_;
+  }
+  int calls{0};
+
+ protected:
+  uint32_t leading_mark_;
+  bool secondary_;
+  bool result_;
+};
+
+template<typename T> static RawTimings encode(const typename T::ProtocolData &data) {
+  RemoteTransmitData dst;
+  T().encode(&dst, data);
+  RawTimings timings = dst.get_data();
+  // Receivers close a frame with the idle gap
+  timings.push_back(-10000);
+  return timings;
+}
+
+TEST(RemoteReceiverDispatchTest, ProtocolsDeclareLeadingMark) {
+  EXPECT_EQ(protocol_leading_mark<NECProtocol>(), 9000u);
+  EXPECT_EQ(protocol_leading_mark<SonyProtocol>(), 2400u);
+  // RC5 frames can start with a space, so it is always decoded
+  EXPECT_EQ(protocol_leading_mark<RC5Protocol>(), 0u);
+}
+
+TEST(RemoteReceiverDispatchTest, OnlyCandidateDecodersRun) {
+  ReplayReceiver receiver;
+  CountingListener<NECProtocol> nec;
+  CountingListener<PioneerProtocol> pioneer;
+  CountingListener<SonyProtocol> sony;
+  CountingListener<SamsungProtocol> samsung;
+  CountingListener<LGProtocol> lg;
+  CountingListener<RC5Protocol> rc5;
+  for (RemoteReceiverListener *listener :
+       std::initializer_list<RemoteReceiverListener *>{&nec, &pioneer, &sony, &samsung, &lg, &rc5})
+    receiver.register_listener(listener);
+
+  receiver.replay(encode<NECProtocol>({.address = 0x1234, .command = 0x5678, .command_repeats = 1}));
+  // NEC and Pioneer share the 9 ms leading mark, LG's 8 ms is within the 25% tolerance and RC5 has none
+  EXPECT_EQ(nec.calls, 1);
+  EXPECT_EQ(nec.decoded, 1);
+  EXPECT_EQ(pioneer.calls, 1);
+  EXPECT_EQ(lg.calls, 1);
+  EXPECT_EQ(rc5.calls, 1);
+  EXPECT_EQ(sony.calls + samsung.calls, 0);
+
+  receiver.replay(encode<SonyProtocol>({.data = 0xABC, .nbits = 12}));
+  EXPECT_EQ(sony.calls, 1);
+  EXPECT_EQ(sony.decoded, 1);
+  EXPECT_EQ(nec.calls, 1);
+  EXPECT_EQ(rc5.calls, 2);
+}
+
+TEST(RemoteReceiverDispatchTest, ReplayMatchesDirectDecode) {
+  const std::vector<RawTimings> frames = {
+      encode<NECProtocol>({.address = 0x00FF, .command = 0x10EF, .command_repeats = 1}),
+      encode<SamsungProtocol>({.data = 0xE0E040BF, .nbits = 32}),
+      encode<LGProtocol>({.data = 0x20DF10EF, .nbits = 32}),
+      encode<SonyProtocol>({.data = 0x0A90, .nbits = 12}),
+      encode<RC5Protocol>({.address = 0x05, .command = 0x35}),
+      encode<PioneerProtocol>({.rc_code_1 = 0xA55A, .rc_code_2 = 0}),
+  };
+  for (auto mode : {TOLERANCE_MODE_PERCENTAGE, TOLERANCE_MODE_TIME}) {
+    const uint32_t tolerance = mode == TOLERANCE_MODE_PERCENTAGE ? 25 : 200;
+    ReplayReceiver receiver;
+    receiver.set_tolerance(tolerance, mode);
+    CountingListener<NECProtocol> nec;
+    CountingListener<SamsungProtocol> samsung;
+    CountingListener<LGProtocol> lg;
+    CountingListener<SonyProtocol> sony;
+    CountingListener<RC5Protocol> rc5;
+    CountingListener<PioneerProtocol> pioneer;
+    for (RemoteReceiverListener *listener :
+         std::initializer_list<RemoteReceiverListener *>{&nec, &samsung, &lg, &sony, &rc5, &pioneer})
+      receiver.register_listener(listener);
+    for (const auto &frame : frames)
+      receiver.replay(frame);
+
+    // Filtering must not lose any frame a decoder would have accepted on its own
+    auto direct = [&](auto protocol) {
+      int decoded = 0;
+      for (const auto &frame : frames)
+        decoded += protocol.decode(RemoteReceiveData(frame, tolerance, mode)).has_value();
+      return decoded;
+    };
+    EXPECT_EQ(nec.decoded, direct(NECProtocol()));
+    EXPECT_EQ(samsung.decoded, direct(SamsungProtocol()));
+    EXPECT_EQ(lg.decoded, direct(LGProtocol()));
+    EXPECT_EQ(sony.decoded, direct(SonyProtocol()));
+    EXPECT_EQ(rc5.decoded, direct(RC5Protocol()));
+    EXPECT_EQ(pioneer.decoded, direct(PioneerProtocol()));
+    EXPECT_LT(nec.calls + samsung.calls + lg.calls + sony.calls + pioneer.calls, 5 * (int) frames.size());
+  }
+}
+
+TEST(RemoteReceiverDispatchTest, SecondaryDumpersRunWhenNoPrimaryMatches) {
+  ReplayReceiver receiver;
+  CountingDumper nec(NECProtocol::LEADING_MARK_US, false, true);
+  CountingDumper sony(SonyProtocol::LEADING_MARK_US, false, true);
+  CountingDumper raw(0, true, true);
+  receiver.register_dumper(&nec);
+  receiver.register_dumper(&sony);
+  receiver.register_dumper(&raw);
+
+  receiver.replay(encode<NECProtocol>({.address = 1, .command = 2, .command_repeats = 1}));
+  EXPECT_EQ(nec.calls, 1);
+  EXPECT_EQ(sony.calls, 0);
+  EXPECT_EQ(raw.calls, 0);
+
+  // A frame none of the primary dumpers can start on falls through to the secondary ones
+  receiver.replay({500, -500, 500, -10000});
+  EXPECT_EQ(nec.calls, 1);
+  EXPECT_EQ(sony.calls, 0);
+  EXPECT_EQ(raw.calls, 1);
+}
+
+}  // namespace esphome::remote_base::testing
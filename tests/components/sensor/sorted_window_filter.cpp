@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "esphome/components/sensor/filter.h"
+
+namespace esphome::sensor::testing {
+
+// Sorts a copy of the window for every value, as the filters did before keeping it sorted incrementally.
+class ReferenceWindow {
+ public:
+  explicit ReferenceWindow(size_t window_size) : window_size_(window_size) {}
+
+  void add(float value) {
+    this->window_.push_back(value);
+    if (this->window_.size() > this->window_size_)
+      this->window_.pop_front();
+  }
+
+  std::vector<float> sorted() const {
+    std::vector<float> values;
+    for (float v : this->window_) {
+      if (!std::isnan(v))
+        values.push_back(v);
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  float median() const {
+    auto values = this->sorted();
+    if (values.empty())
+      return NAN;
+    const size_t mid = values.size() / 2;
+    return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0f;
+  }
+
+  float quantile(float quantile) const {
+    auto values = this->sorted();
+    if (values.empty())
+      return NAN;
+    return values[static_cast<size_t>(ceilf(values.size() * quantile)) - 1];
+  }
+
+ protected:
+  size_t window_size_;
+  std::deque<float> window_;
+};
+
+static void expect_same(float actual, float expected, size_t step) {
+  if (std::isnan(expected)) {
+    EXPECT_TRUE(std::isnan(actual)) << "step " << step;
+  } else {
+    EXPECT_EQ(actual, expected) << "step " << step;
+  }
+}
+
+// Few distinct values, so windows hold many duplicates and equal values leave them, with some NaN in between
+static std::vector<float> random_sequence(uint32_t seed, size_t length) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> value(-4, 4);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::vector<float> sequence;
+  for (size_t i = 0; i < length; i++)
+    sequence.push_back(percent(rng) < 15 ? NAN : value(rng) * 0.5f);
+  return sequence;
+}
+
+static void check_median(size_t window_size, const std::vector<float> &sequence) {
+  SCOPED_TRACE(::testing::Message() << "window " << window_size);
+  MedianFilter filter(window_size, 1, 1);
+  ReferenceWindow reference(window_size);
+  for (size_t i = 0; i < sequence.size(); i++) {
+    reference.add(sequence[i]);
+    auto result = filter.new_value(sequence[i]);
+    ASSERT_TRUE(result.has_value());
+    expect_same(*result, reference.median(), i);
+  }
+}
+
+static void check_quantile(size_t window_size, float quantile, const std::vector<float> &sequence) {
+  SCOPED_TRACE(::testing::Message() << "window " << window_size << ", quantile " << quantile);
+  QuantileFilter filter(window_size, 1, 1, quantile);
+  ReferenceWindow reference(window_size);
+  for (size_t i = 0; i < sequence.size(); i++) {
+    reference.add(sequence[i]);
+    auto result = filter.new_value(sequence[i]);
+    ASSERT_TRUE(result.has_value());
+    expect_same(*result, reference.quantile(quantile), i);
+  }
+}
+
+TEST(SortedWindowFilterTest, MedianMatchesSortedReference) {
+  for (size_t window_size : {1, 2, 3, 4, 5, 8, 16}) {
+    for (uint32_t seed = 1; seed <= 4; seed++)
+      check_median(window_size, random_sequence(seed, 500));
+  }
+}
+
+TEST(SortedWindowFilterTest, QuantileMatchesSortedReference) {
+  for (size_t window_size : {1, 2, 3, 5, 16}) {
+    for (float quantile : {0.1f, 0.25f, 0.5f, 0.9f, 1.0f})
+      check_quantile(window_size, quantile, random_sequence(window_size, 500));
+  }
+}
+
+TEST(SortedWindowFilterTest, EqualValuesLeaveOneAtATime) {
+  // Each equal value leaving the window must remove exactly one entry
+  const std::vector<float> sequence = {2, 2, 2, 2, 1, 1, 3, 2, 2, 3, 3, 3, 3, 1, 1, 1, 1};
+  check_median(4, sequence);
+  check_quantile(4, 0.75f, sequence);
+}
+
+TEST(SortedWindowFilterTest, NanEntersAndLeaves) {
+  const std::vector<float> sequence = {NAN, 1, NAN, NAN, NAN, 5, 2, NAN, 2, 7, NAN, NAN, NAN, NAN, 4};
+  check_median(1, sequence);
+  check_median(2, sequence);
+  check_median(3, sequence);
+  check_quantile(2, 0.5f, sequence);
+  check_quantile(3, 1.0f, sequence);
+}
+
+TEST(SortedWindowFilterTest, AllNanGivesNan) {
+  MedianFilter filter(3, 1, 1);
+  for (int i = 0; i < 5; i++) {
+    auto result = filter.new_value(NAN);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(std::isnan(*result));
+  }
+  auto result = filter.new_value(6);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(*result, 6);
+}
+
+}  // namespace esphome::sensor::testing
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "esphome/components/spi/spi_queue.h"
+
+namespace esphome::spi::testing {
+
+static constexpr size_t CHUNK = 4092;
+
+// Drives a pipeline the way the delegate does, recording each step as a letter: Q(ueue), C(ollect), Y(ield), D(one).
+// `waiting` tells for each step whether a more urgent device waits; a yield hands it the bus, so it stops waiting.
+struct StepLog {
+  std::string steps;
+  std::vector<size_t> chunks;
+  uint8_t max_in_flight{0};
+};
+
+static StepLog run(SPIChunkPipeline &pipeline, const std::function<bool(size_t)> &waiting, size_t fail_at = SIZE_MAX) {
+  StepLog result;
+  bool yielded = false;
+  for (size_t i = 0; i != 100; i++) {
+    const bool urgent = !yielded && waiting(i);
+    switch (pipeline.next(urgent)) {
+      case SPIChunkPipeline::STEP_QUEUE:
+        result.steps += 'Q';
+        result.chunks.push_back(pipeline.queue());
+        if (result.chunks.size() == fail_at) {
+          pipeline.collected();
+          pipeline.abort();
+        }
+        result.max_in_flight = std::max(result.max_in_flight, pipeline.get_in_flight());
+        break;
+      case SPIChunkPipeline::STEP_COLLECT:
+        result.steps += 'C';
+        pipeline.collected();
+        break;
+      case SPIChunkPipeline::STEP_YIELD:
+        result.steps += 'Y';
+        EXPECT_EQ(pipeline.get_in_flight(), 0);
+        yielded = true;
+        pipeline.resumed();
+        break;
+      case SPIChunkPipeline::STEP_DONE:
+        result.steps += 'D';
+        return result;
+    }
+  }
+  ADD_FAILURE() << "pipeline did not finish";
+  return result;
+}
+
+TEST(SPIChunkPipelineTest, KeepsTwoChunksInFlight) {
+  SPIChunkPipeline pipeline(3 * CHUNK + 100, CHUNK, 2, true);
+  StepLog result = run(pipeline, [](size_t) { return false; });
+  EXPECT_EQ(result.steps, "QQCQCQCCD");
+  EXPECT_EQ(result.chunks, (std::vector<size_t>{CHUNK, CHUNK, CHUNK, 100}));
+  EXPECT_EQ(result.max_in_flight, 2);
+  EXPECT_EQ(pipeline.get_remaining(), 0u);
+}
+
+TEST(SPIChunkPipelineTest, DrainsBeforeYielding) {
+  SPIChunkPipeline pipeline(4 * CHUNK, CHUNK, 2, true);
+  // The urgent device turns up while the first two chunks are in flight
+  StepLog result = run(pipeline, [](size_t step) { return step >= 2; });
+  // No chunk is queued between the request and the hand-over, and both chunks in flight complete first
+  EXPECT_EQ(result.steps, "QQCCYQQCCD");
+  EXPECT_EQ(result.chunks, (std::vector<size_t>{CHUNK, CHUNK, CHUNK, CHUNK}));
+}
+
+TEST(SPIChunkPipelineTest, StopsQueueingOnceRequested) {
+  SPIChunkPipeline pipeline(5 * CHUNK, CHUNK, 2, true);
+  // Requested after a chunk was collected, when the delegate would otherwise refill the queue
+  StepLog result = run(pipeline, [](size_t step) { return step >= 3; });
+  EXPECT_EQ(result.steps, "QQCCYQQCQCCD");
+}
+
+TEST(SPIChunkPipelineTest, NonPreemptibleKeepsTheBus) {
+  SPIChunkPipeline pipeline(3 * CHUNK, CHUNK, 2, false);
+  StepLog result = run(pipeline, [](size_t) { return true; });
+  EXPECT_EQ(result.steps, "QQCQCCD");
+}
+
+TEST(SPIChunkPipelineTest, NoYieldAfterLastChunkQueued) {
+  SPIChunkPipeline pipeline(2 * CHUNK, CHUNK, 2, true);
+  // Nothing is left to resume, so the transfer finishes and the bus is released the normal way
+  StepLog result = run(pipeline, [](size_t step) { return step >= 2; });
+  EXPECT_EQ(result.steps, "QQCCD");
+}
+
+TEST(SPIChunkPipelineTest, AbortCollectsChunksInFlight) {
+  SPIChunkPipeline pipeline(4 * CHUNK, CHUNK, 2, true);
+  // The second chunk fails to queue; the first is still collected
+  StepLog result = run(pipeline, [](size_t) { return false; }, 2);
+  EXPECT_EQ(result.steps, "QQCD");
+  EXPECT_EQ(pipeline.get_in_flight(), 0);
+}
+
+TEST(SPIChunkPipelineTest, AbortWhileYieldingFinishes) {
+  SPIChunkPipeline pipeline(4 * CHUNK, CHUNK, 2, true);
+  EXPECT_EQ(pipeline.next(false), SPIChunkPipeline::STEP_QUEUE);
+  pipeline.queue();
+  EXPECT_EQ(pipeline.next(true), SPIChunkPipeline::STEP_COLLECT);
+  pipeline.abort();
+  EXPECT_EQ(pipeline.next(true), SPIChunkPipeline::STEP_COLLECT);
+  pipeline.collected();
+  EXPECT_EQ(pipeline.next(true), SPIChunkPipeline::STEP_DONE);
+}
+
+TEST(SPIWaitersTest, OnlyHigherPrioritiesCount) {
+  SPIWaiters waiters;
+  EXPECT_FALSE(waiters.is_waiting_above(0));
+  waiters.add(3);
+  EXPECT_TRUE(waiters.is_waiting_above(0));
+  EXPECT_TRUE(waiters.is_waiting_above(2));
+  EXPECT_FALSE(waiters.is_waiting_above(3));
+  EXPECT_FALSE(waiters.is_waiting_above(SPI_PRIORITY_LEVELS - 1));
+  waiters.add(3);
+  waiters.remove(3);
+  EXPECT_TRUE(waiters.is_waiting_above(2));
+  waiters.remove(3);
+  EXPECT_FALSE(waiters.is_waiting_above(0));
+}
+
+}  // namespace esphome::spi::testing
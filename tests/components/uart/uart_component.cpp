@@ -70,4 +70,42 @@ TEST(UARTComponentTest, ReadByteFailure) {
   EXPECT_FALSE(mock.read_byte(&value));
 }
 
+// Tests for the default bulk read built on available() and read_array
+TEST(UARTComponentTest, ReadAvailableReadsBufferedBytes) {
+  MockUARTComponent mock;
+  uint8_t buffer[8];
+  EXPECT_CALL(mock, available()).WillOnce(Return(3));
+  EXPECT_CALL(mock, read_array(buffer, 3)).WillOnce(Return(true));
+  EXPECT_EQ(mock.read_available(buffer), 3);
+}
+
+TEST(UARTComponentTest, ReadAvailableLimitedByBuffer) {
+  MockUARTComponent mock;
+  uint8_t buffer[4];
+  EXPECT_CALL(mock, available()).WillOnce(Return(10));
+  EXPECT_CALL(mock, read_array(buffer, 4)).WillOnce(Return(true));
+  EXPECT_EQ(mock.read_available(buffer), 4);
+}
+
+TEST(UARTComponentTest, ReadAvailableNothingBuffered) {
+  MockUARTComponent mock;
+  uint8_t buffer[4];
+  EXPECT_CALL(mock, available()).WillOnce(Return(0));
+  EXPECT_CALL(mock, read_array(_, _)).Times(0);
+  EXPECT_EQ(mock.read_available(buffer), 0);
+}
+
+TEST(UARTComponentTest, ReadAvailableFailure) {
+  MockUARTComponent mock;
+  uint8_t buffer[4];
+  EXPECT_CALL(mock, available()).WillOnce(Return(2));
+  EXPECT_CALL(mock, read_array(buffer, 2)).WillOnce(Return(false));
+  EXPECT_EQ(mock.read_available(buffer), 0);
+}
+
+TEST(UARTComponentTest, RegisterRxListenerUnsupportedByDefault) {
+  MockUARTComponent mock;
+  EXPECT_FALSE(mock.register_rx_listener(nullptr));
+}
+
 }  // namespace esphome::uart::testing
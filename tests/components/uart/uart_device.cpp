@@ -48,6 +48,15 @@ TEST(UARTDeviceTest, Available) {
   EXPECT_EQ(dev.available(), 5);
 }
 
+TEST(UARTDeviceTest, ReadAvailable) {
+  MockUARTComponent mock;
+  UARTDevice dev(&mock);
+  uint8_t buffer[16];
+  EXPECT_CALL(mock, available()).WillOnce(Return(5));
+  EXPECT_CALL(mock, read_array(buffer, 5)).WillOnce(Return(true));
+  EXPECT_EQ(dev.read_available(buffer), 5);
+}
+
 TEST(UARTDeviceTest, FlushCallsParent) {
   MockUARTComponent mock;
   UARTDevice dev(&mock);